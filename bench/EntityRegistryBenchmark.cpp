@@ -0,0 +1,95 @@
+#include "../src/headers.h"
+#include "../src/Entities/EntityRegistry.h"
+#include "../src/Entities/SpatialHash.h"
+#include "../src/Math/Random.h"
+
+// Cost of one simulation step of the demons stored in the registry (systems and broad phase, no rendering)
+
+namespace
+{
+
+const int STEPS = 120;                  // One second at the simulation rate
+const float STEP = 1.0f / 120.0f;
+
+/**
+ * @brief Function that benchmarks a number of demons running towards the player
+ */
+void benchmark(std::size_t count)
+{
+    EntityRegistry registry(count);
+    EntityRegistry::Kind kind = registry.addArchetype(EntityArchetype {
+        Vector(64.0f), Vector(0.0f, 0.0f), Vector(32.0f, 32.0f),
+        MovementComponents(300.0f, 1740.0f, 300.0f), 50.0f, 0.2f,
+        AnimationTable::getID("demon_walk"), TextureRegion {}
+    });
+
+    RandomStream random(1234);
+    float side = 256.0f * std::sqrt(static_cast<float>(count));
+    for (std::size_t i = 0; i < count; ++i)
+        registry.create(kind, Vector(random.nextFloat(-side, side), random.nextFloat(-side, side)));
+
+    SpatialHash broadPhase;
+    std::vector<SpatialHash::Pair> pairs;
+    std::vector<TerrainBody> bodies;
+    Vector player(0.0f, 0.0f);
+
+    double systems = 0.0, collisions = 0.0;
+    for (int step = 0; step < STEPS; ++step)
+    {
+        auto start = std::chrono::steady_clock::now();
+        registry.attract(player);
+        registry.move(STEP);
+        registry.updateDamage(STEP);
+        registry.updateHitboxes();
+        registry.animate(STEP);
+
+        bodies.clear();
+        registry.addTerrainBodies(bodies);
+        registry.applyTerrainCollision(bodies.data());
+        auto middle = std::chrono::steady_clock::now();
+
+        broadPhase.clear();
+        for (const sf::FloatRect& hitbox : registry.getHitboxes())
+            broadPhase.insert(hitbox);
+        broadPhase.build();
+        broadPhase.findPairs(pairs);
+        auto end = std::chrono::steady_clock::now();
+
+        systems += std::chrono::duration<double, std::milli>(middle - start).count();
+        collisions += std::chrono::duration<double, std::milli>(end - middle).count();
+    }
+
+    // A tenth of the demons killed and spawned again every step
+    double churn = 0.0;
+    for (int step = 0; step < STEPS; ++step)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (std::size_t i = 0; i < count / 10; ++i)
+            registry.damage(static_cast<EntityRegistry::Index>(random.nextInt(0, static_cast<int>(registry.size()) - 1)), 1000.0f);
+        registry.removeDead();
+        while (!registry.isFull())
+            registry.create(kind, Vector(random.nextFloat(-side, side), random.nextFloat(-side, side)));
+        auto end = std::chrono::steady_clock::now();
+
+        churn += std::chrono::duration<double, std::milli>(end - start).count();
+    }
+
+    std::cout << std::right << std::setw(7) << count << " demons"
+              << std::setw(10) << std::fixed << std::setprecision(3) << systems / STEPS << " ms (systems)"
+              << std::setw(10) << collisions / STEPS << " ms (broad phase)"
+              << std::setw(10) << (systems + collisions) / STEPS * 1e6 / static_cast<double>(count) << " ns/demon"
+              << std::setw(10) << churn / STEPS << " ms (10% despawned and spawned)" << std::endl;
+}
+
+}
+
+int main()
+{
+    std::cout << "One simulation step (average of " << STEPS << " steps)" << std::endl;
+
+    benchmark(1000);
+    benchmark(10000);
+    benchmark(100000);
+
+    return 0;
+}
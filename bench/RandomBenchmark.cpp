@@ -0,0 +1,133 @@
+#include "../src/headers.h"
+#include "../src/Math/Random.h"
+
+// Compares the previous random numbers of the world generation (srand / rand seeded with a hash of the position)
+// with the stateless position hash and the seeded streams
+
+namespace
+{
+
+const int AREA = 1024;                  // Side of the area sampled (in tiles)
+const int BUCKETS = 80;                 // Same range as the natural elements
+const unsigned int THREADS = 4;
+
+/**
+ * @brief Hash previously used to seed the generator of a tile
+ */
+unsigned int oldHash(int x, int y)
+{
+    return static_cast<unsigned int>((x * y) ^ (y << 1));
+}
+
+int oldRand(int x, int y)
+{
+    srand(oldHash(x, y));
+    return rand() % BUCKETS;
+}
+
+int oldMinstd(int x, int y)
+{
+    std::minstd_rand engine(oldHash(x, y));
+    return static_cast<int>(engine() % BUCKETS);
+}
+
+int positionHash(int x, int y)
+{
+    return static_cast<int>((static_cast<std::uint64_t>(Random::hash(1234, x, y, Random::TERRAIN_NATURE)) * BUCKETS) >> 32);
+}
+
+/**
+ * @brief Function that samples a whole area with one method
+ * @param sample        Method
+ * @param firstRow      First row sampled
+ * @param rows          Number of rows sampled
+ * @param counts        Number of samples in each bucket
+ */
+void sampleArea(int (*sample)(int, int), int firstRow, int rows, std::vector<long>& counts)
+{
+    for (int y = firstRow; y < firstRow + rows; ++y)
+    {
+        for (int x = -AREA / 2; x < AREA / 2; ++x)
+        {
+            ++counts[static_cast<std::size_t>(sample(x, y))];
+        }
+    }
+}
+
+/**
+ * @brief Chi-square of the buckets against a uniform distribution (around BUCKETS - 1 when uniform)
+ */
+double chiSquare(const std::vector<long>& counts)
+{
+    double total = static_cast<double>(std::accumulate(counts.begin(), counts.end(), 0L));
+    double expected = total / BUCKETS;
+    double chi = 0.0;
+    for (long count : counts)
+        chi += (static_cast<double>(count) - expected) * (static_cast<double>(count) - expected) / expected;
+
+    return chi;
+}
+
+/**
+ * @brief Function that benchmarks a method on one thread and on several threads
+ */
+void benchmark(const std::string& name, int (*sample)(int, int))
+{
+    std::vector<long> counts(BUCKETS, 0);
+
+    auto start = std::chrono::steady_clock::now();
+    sampleArea(sample, -AREA / 2, AREA, counts);
+    double single = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    // Same area split between threads (like the chunk workers)
+    std::vector<std::vector<long>> threadCounts(THREADS, std::vector<long>(BUCKETS, 0));
+    std::vector<std::thread> threads;
+    start = std::chrono::steady_clock::now();
+    for (unsigned int i = 0; i < THREADS; ++i)
+    {
+        int rows = AREA / static_cast<int>(THREADS);
+        threads.emplace_back(sampleArea, sample, -AREA / 2 + static_cast<int>(i) * rows, rows, std::ref(threadCounts[i]));
+    }
+    for (std::thread& thread : threads)
+        thread.join();
+    double multi = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    double samples = static_cast<double>(AREA) * AREA;
+    std::cout << std::left << std::setw(28) << name
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << single * 1e6 / samples << " ns/tile"
+              << std::setw(10) << multi * 1e6 / samples << " ns/tile (" << THREADS << " threads)"
+              << std::setw(14) << std::setprecision(1) << chiSquare(counts) << " chi2" << std::endl;
+}
+
+/**
+ * @brief Function that benchmarks the seeded stream used by the gameplay systems
+ */
+void benchmarkStream()
+{
+    RandomStream stream(1234, Random::DEMON_SPAWNER);
+    std::vector<long> counts(BUCKETS, 0);
+
+    auto start = std::chrono::steady_clock::now();
+    for (long i = 0; i < static_cast<long>(AREA) * AREA; ++i)
+        ++counts[static_cast<std::size_t>(stream.nextInt(0, BUCKETS - 1))];
+    double single = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << std::left << std::setw(28) << "RandomStream::nextInt"
+              << std::right << std::setw(10) << std::fixed << std::setprecision(2) << single * 1e6 / (static_cast<double>(AREA) * AREA) << " ns/call"
+              << std::setw(50) << std::setprecision(1) << chiSquare(counts) << " chi2" << std::endl;
+}
+
+}
+
+int main()
+{
+    std::cout << "Random numbers of " << AREA << "x" << AREA << " tiles in " << BUCKETS << " buckets"
+              << " (chi2 close to " << BUCKETS - 1 << " when uniform)" << std::endl;
+
+    benchmark("srand(hash) + rand", oldRand);
+    benchmark("minstd_rand(hash)", oldMinstd);
+    benchmark("Random::hash", positionHash);
+    benchmarkStream();
+
+    return 0;
+}
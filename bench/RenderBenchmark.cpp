@@ -0,0 +1,179 @@
+#include "../src/headers.h"
+#include "../src/Game.h"
+#include "../src/Simulation/World.h"
+#include "../src/Simulation/InputScript.h"
+#include "../src/HUD/InventoryBar.h"
+#include "../src/HUD/ExperienceBar.h"
+
+// Draws a seeded world into a texture while the camera follows scripted paths (no window)
+// Reports per frame and per renderer : draw calls, vertices, texture binds and state changes submitted,
+// CPU time to record and to submit (counted by an instrumented target : a batching regression changes the counts)
+// Needs an OpenGL context : without a display, run it with xvfb-run (LIBGL_ALWAYS_SOFTWARE=1 for Mesa llvmpipe)
+
+namespace
+{
+
+const unsigned int WIDTH = 1280;
+const unsigned int HEIGHT = 720;
+const int SEED = 1;
+const std::size_t FRAMES = 600;
+const std::size_t STEPS_PER_FRAME = 2;      // 60 frames per second
+const int STEPS_PER_MOVE = 240;
+
+// Part of the frame drawn separately (same name as the section recorded by the renderer)
+struct Section
+{
+    std::string name;
+    std::function<void(std::shared_ptr<RenderSnapshot>)> record;
+
+    RenderCounters counters;
+    double recordTime;
+    double submitTime;
+};
+
+/**
+ * @brief Function that returns the time since a point in milliseconds
+ */
+double getElapsed(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Function that creates the path of the camera (the camera follows the player)
+ * @param name      Square around the spawn or random walk
+ */
+InputScript createPath(const std::string& name)
+{
+    if (name == "square")
+    {
+        InputScript script;
+        script.add(RIGHT, STEPS_PER_MOVE);
+        script.add(DOWN, STEPS_PER_MOVE);
+        script.add(LEFT, STEPS_PER_MOVE);
+        script.add(UP, STEPS_PER_MOVE);
+        return script;
+    }
+
+    return InputScript::createRandomWalk(static_cast<std::uint64_t>(SEED), 16, STEPS_PER_MOVE / 2);
+}
+
+/**
+ * @brief Function that draws the frames of a path and prints the cost of each renderer
+ */
+void benchmark(sf::RenderTexture& texture, const std::string& path)
+{
+    World world(sf::Vector2f(static_cast<float>(WIDTH), static_cast<float>(HEIGHT)), SEED, World::OFFSCREEN);
+    world.addTextures(ResourceCache::getSheet("PLAYER_SPRITE_SHEET"), ResourceCache::getSheet("SWORD_SPRITE_SHEET"),
+            ResourceCache::getSheet("ATTACK_SPRITE_SHEET"), ResourceCache::getSheet("DEMON_SPRITE_SHEET"));
+    world.getMap().waitForLoading();
+
+    // HUD of the game state
+    std::shared_ptr<sf::Font> font = ResourceCache::getFont("fonts/basic_font.ttf");
+    sf::View interfaceView(sf::FloatRect(0.0f, 0.0f, static_cast<float>(WIDTH), static_cast<float>(HEIGHT)));
+    HUD::InventoryBar inventoryBar(
+        Vector(static_cast<float>(WIDTH) / 2.0f - 16 * TileHandler::DEFAULT_SIZE / 2.0f, static_cast<float>(HEIGHT) - 4 * TileHandler::DEFAULT_SIZE),
+        Vector(16 * TileHandler::DEFAULT_SIZE, 2 * TileHandler::DEFAULT_SIZE)
+    );
+    HUD::ExperienceBar experienceBar(*font, Vector(512.0f, 8.0f), Vector(static_cast<float>(WIDTH) / 2.0f - 256.0f, 16.0f));
+
+    std::vector<Section> sections = {
+        { "map", [&] (std::shared_ptr<RenderSnapshot> target) {
+            target->setView(world.getInterpolatedView());
+            world.getMap().render(target);
+        }, RenderCounters(), 0.0, 0.0 },
+        { "entities", [&] (std::shared_ptr<RenderSnapshot> target) {
+            target->setView(world.getInterpolatedView());
+            world.renderEntities(target);
+        }, RenderCounters(), 0.0, 0.0 },
+        { "map on top", [&] (std::shared_ptr<RenderSnapshot> target) {
+            target->setView(world.getInterpolatedView());
+            world.renderOnTop(target);
+        }, RenderCounters(), 0.0, 0.0 },
+        { "HUD", [&] (std::shared_ptr<RenderSnapshot> target) {
+            target->setView(interfaceView);
+            inventoryBar.render(target);
+            experienceBar.render(target);
+        }, RenderCounters(), 0.0, 0.0 }
+    };
+
+    InputScript script = createPath(path);
+    std::shared_ptr<RenderSnapshot> snapshot = std::make_shared<RenderSnapshot>();
+    std::vector<double> frameTimes(FRAMES);
+
+    for (std::size_t frame = 0; frame < FRAMES; ++frame)
+    {
+        for (std::size_t i = 0; i < STEPS_PER_FRAME; ++i)
+        {
+            script.apply(world.getPlayer(), frame * STEPS_PER_FRAME + i);
+            world.update(Game::TIME_STEP);
+        }
+        world.interpolate(1.0f);
+
+        // One target for the frame : a texture bound by a section stays bound for the next one
+        auto frameStart = std::chrono::steady_clock::now();
+        InstrumentedRenderTarget target(&texture);
+        texture.clear();
+        for (Section& section : sections)
+        {
+            snapshot->clear();
+
+            auto start = std::chrono::steady_clock::now();
+            snapshot->beginSection(section.name);
+            section.record(snapshot);
+            section.recordTime += getElapsed(start);
+
+            start = std::chrono::steady_clock::now();
+            snapshot->replay(target);
+            section.submitTime += getElapsed(start);
+        }
+        texture.display();
+        frameTimes[frame] = getElapsed(frameStart);
+
+        for (Section& section : sections)
+        {
+            for (const InstrumentedRenderTarget::Section& counted : target.getSections())
+            {
+                if (counted.first == section.name)
+                    section.counters += counted.second;
+            }
+        }
+    }
+
+    std::cout << "Path " << path << " (" << FRAMES << " frames, seed " << SEED << ", " << world.getMap().getNumberOfChunks() << " chunks loaded)" << std::endl;
+    double frames = static_cast<double>(FRAMES);
+    for (const Section& section : sections)
+    {
+        std::cout << std::left << std::setw(18) << section.name << std::right
+                  << std::setw(8) << std::fixed << std::setprecision(1) << static_cast<double>(section.counters.draws) / frames << " draws"
+                  << std::setw(10) << std::setprecision(0) << static_cast<double>(section.counters.vertices) / frames << " vertices"
+                  << std::setw(7) << std::setprecision(1) << static_cast<double>(section.counters.textureBinds) / frames << " binds"
+                  << std::setw(7) << static_cast<double>(section.counters.stateChanges) / frames << " states"
+                  << std::setw(9) << std::setprecision(3) << section.recordTime / frames << " ms (record)"
+                  << std::setw(9) << section.submitTime / frames << " ms (submit)" << std::endl;
+    }
+
+    std::sort(frameTimes.begin(), frameTimes.end());
+    std::cout << std::left << std::setw(18) << "frame" << std::right
+              << std::setw(9) << std::setprecision(3) << frameTimes[FRAMES / 2] << " ms (p50)"
+              << std::setw(9) << frameTimes[FRAMES * 99 / 100] << " ms (p99)" << std::endl << std::endl;
+}
+
+}
+
+int main()
+{
+    sf::RenderTexture texture;
+    if (!texture.create(WIDTH, HEIGHT))
+    {
+        std::cout << "No OpenGL context : skipped (without a display, use xvfb-run)" << std::endl;
+        return 0;
+    }
+
+    benchmark(texture, "square");
+    benchmark(texture, "walk");
+
+    ResourceCache::clear();
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+#include "../src/headers.h"
+#include "../src/Game.h"
+#include "../src/Simulation/World.h"
+#include "../src/Simulation/InputScript.h"
+
+// Headless simulation (no window) : chunk generation throughput, terrain collision cost per entity
+// and update time per step for fixed seeds (the state hash must be the same on every run)
+
+namespace
+{
+
+const std::vector<int> SEEDS = { 1, 2, 3 };
+const int CHUNKS_PER_SIDE = 8;              // Chunks generated : side x side
+const int COLLISION_FRAMES = 20;
+const std::size_t STEPS = 1200;             // 10 seconds simulated
+const int RANDOM_MOVES = 10;
+const int STEPS_PER_MOVE = 120;
+
+/**
+ * @brief Function that returns the time since a point in milliseconds
+ */
+double getElapsed(const std::chrono::steady_clock::time_point& start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+/**
+ * @brief Function that generates chunks on the main thread, then with the pool of workers
+ */
+void benchmarkChunkGeneration(int seed)
+{
+    TerrainGenerator terrain(seed);
+    std::size_t count = static_cast<std::size_t>(CHUNKS_PER_SIDE * CHUNKS_PER_SIDE);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int y = 0; y < CHUNKS_PER_SIDE; ++y)
+    {
+        for (int x = 0; x < CHUNKS_PER_SIDE; ++x)
+            Chunk chunk(nullptr, terrain, ChunkCoord(x, y));
+    }
+    double single = getElapsed(start);
+
+    std::size_t workers = ChunkGenerator::getDefaultNumberOfWorkers();
+    start = std::chrono::steady_clock::now();
+    {
+        ChunkGenerator generator(nullptr, terrain, nullptr, Vector(Chunk::DEFAULT_SIZE), Vector(TileHandler::DEFAULT_SIZE), workers);
+        for (int y = 0; y < CHUNKS_PER_SIDE; ++y)
+        {
+            for (int x = 0; x < CHUNKS_PER_SIDE; ++x)
+                generator.request(ChunkCoord(x, y));
+        }
+        generator.wait();
+        count = generator.collect().size();
+    }
+    double pool = getElapsed(start);
+
+    std::cout << "seed " << seed << std::right << std::setw(6) << count << " chunks"
+              << std::setw(10) << std::fixed << std::setprecision(1) << static_cast<double>(count) * 1000.0 / single << " chunks/s (1 thread)"
+              << std::setw(10) << static_cast<double>(count) * 1000.0 / pool << " chunks/s (" << workers << " workers)" << std::endl;
+}
+
+/**
+ * @brief Function that collides bodies moving in random directions around the spawn with the terrain
+ */
+void benchmarkCollision(World& world, std::size_t count)
+{
+    RandomStream random(1234);
+    float side = static_cast<float>(2 * ChunkStreamer::DEFAULT_LOAD_RADIUS) * Chunk::DEFAULT_SIZE * TileHandler::DEFAULT_SIZE * 0.5f;
+    Vector center = world.getPlayer().getPosition();
+
+    std::vector<TerrainBody> initial(count);
+    for (TerrainBody& body : initial)
+    {
+        Vector movement(random.nextFloat(-4.0f, 4.0f), random.nextFloat(-4.0f, 4.0f));
+        body.aabb = sf::FloatRect(center.getX() + random.nextFloat(-side, side) * 0.5f, center.getY() + random.nextFloat(-side, side) * 0.5f, 32.0f, 32.0f);
+        body.movement = movement;
+        body.velocity = movement * 120.0f;
+    }
+
+    std::vector<TerrainBody> bodies;
+    double total = 0.0;
+    for (int i = 0; i < COLLISION_FRAMES; ++i)
+    {
+        bodies = initial;
+        auto start = std::chrono::steady_clock::now();
+        world.getMap().collide(bodies.data(), bodies.size());
+        total += getElapsed(start);
+    }
+
+    double frame = total / COLLISION_FRAMES;
+    std::cout << std::right << std::setw(6) << count << " bodies"
+              << std::setw(10) << std::fixed << std::setprecision(3) << frame << " ms/frame"
+              << std::setw(10) << std::setprecision(1) << frame * 1e6 / static_cast<double>(count) << " ns/body" << std::endl;
+}
+
+/**
+ * @brief Function that simulates a random walk and returns the state hash at the end
+ */
+std::uint64_t benchmarkUpdate(int seed)
+{
+    World world(sf::Vector2f(1280.0f, 720.0f), seed, World::HEADLESS);
+    world.getMap().waitForLoading();
+    InputScript script = InputScript::createRandomWalk(static_cast<std::uint64_t>(seed), RANDOM_MOVES, STEPS_PER_MOVE);
+
+    std::vector<double> times(STEPS);
+    for (std::size_t step = 0; step < STEPS; ++step)
+    {
+        auto start = std::chrono::steady_clock::now();
+        script.apply(world.getPlayer(), step);
+        world.update(Game::TIME_STEP);
+        times[step] = getElapsed(start);
+    }
+
+    double mean = std::accumulate(times.begin(), times.end(), 0.0) / static_cast<double>(STEPS);
+    std::sort(times.begin(), times.end());
+
+    std::cout << "seed " << seed
+              << std::setw(10) << std::fixed << std::setprecision(3) << mean << " ms/step (mean)"
+              << std::setw(10) << times[STEPS * 99 / 100] << " ms (p99)"
+              << std::setw(10) << times.back() << " ms (max)"
+              << std::setw(6) << world.getMap().getNumberOfChunks() << " chunks"
+              << std::setw(4) << world.getDemonSpawner().getEntities().size() << " demons"
+              << "  hash " << std::hex << world.getStateHash() << std::dec;
+
+    return world.getStateHash();
+}
+
+}
+
+int main()
+{
+    std::cout << "Chunk generation (" << CHUNKS_PER_SIDE << " x " << CHUNKS_PER_SIDE << " chunks)" << std::endl;
+    for (int seed : SEEDS)
+        benchmarkChunkGeneration(seed);
+
+    std::cout << "\nTerrain collision around the spawn (average of " << COLLISION_FRAMES << " frames, seed " << SEEDS[0] << ")" << std::endl;
+    {
+        World world(sf::Vector2f(1280.0f, 720.0f), SEEDS[0], World::HEADLESS);
+        world.getMap().waitForLoading();
+        benchmarkCollision(world, 1);
+        benchmarkCollision(world, 100);
+        benchmarkCollision(world, 1000);
+        benchmarkCollision(world, 10000);
+    }
+
+    std::cout << "\nUpdate (" << STEPS << " steps of " << Game::TIME_STEP * 1000.0f << " ms, random walk)" << std::endl;
+    for (int seed : SEEDS)
+    {
+        std::uint64_t first = benchmarkUpdate(seed);
+        std::cout << std::endl;
+
+        // Same seed and inputs : same world
+        std::uint64_t second = benchmarkUpdate(seed);
+        std::cout << (first == second ? "" : "  NOT REPRODUCIBLE") << std::endl;
+    }
+
+    return 0;
+}
@@ -0,0 +1,105 @@
+#include "../src/headers.h"
+#include "../src/Entities/SpatialHash.h"
+#include "../src/Math/Random.h"
+
+// Compares the broad phase (spatial hash rebuilt every frame) with testing every pair of hitboxes
+
+namespace
+{
+
+const float HITBOX_SIZE = 64.0f;            // Size of a demon hitbox
+const float AREA_PER_ENTITY = 256.0f;       // Side of the area of one entity (same density whatever the count)
+const int FRAMES = 20;
+
+/**
+ * @brief Function that creates hitboxes at random positions
+ * @param count     Number of hitboxes
+ */
+std::vector<sf::FloatRect> createHitboxes(std::size_t count)
+{
+    RandomStream random(1234);
+    float side = AREA_PER_ENTITY * std::sqrt(static_cast<float>(count));
+
+    std::vector<sf::FloatRect> hitboxes;
+    hitboxes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        float size = random.nextFloat(0.5f, 1.0f) * HITBOX_SIZE;
+        hitboxes.emplace_back(random.nextFloat(0.0f, side), random.nextFloat(0.0f, side), size, size);
+    }
+
+    return hitboxes;
+}
+
+/**
+ * @brief Function that finds the intersecting pairs by testing every pair
+ */
+std::size_t bruteForce(const std::vector<sf::FloatRect>& hitboxes)
+{
+    std::size_t pairs = 0;
+    for (std::size_t i = 0; i < hitboxes.size(); ++i)
+    {
+        for (std::size_t j = i + 1; j < hitboxes.size(); ++j)
+        {
+            if (hitboxes[i].intersects(hitboxes[j]))
+                ++pairs;
+        }
+    }
+
+    return pairs;
+}
+
+/**
+ * @brief Function that finds the intersecting pairs with the spatial hash (rebuilt like every frame)
+ */
+std::size_t broadPhase(SpatialHash& hash, const std::vector<sf::FloatRect>& hitboxes, std::vector<SpatialHash::Pair>& pairs)
+{
+    hash.clear();
+    for (const sf::FloatRect& hitbox : hitboxes)
+        hash.insert(hitbox);
+    hash.build();
+    hash.findPairs(pairs);
+
+    return pairs.size();
+}
+
+/**
+ * @brief Function that benchmarks both methods for a number of entities
+ */
+void benchmark(std::size_t count)
+{
+    std::vector<sf::FloatRect> hitboxes = createHitboxes(count);
+    SpatialHash hash;
+    std::vector<SpatialHash::Pair> pairs;
+
+    std::size_t brutePairs = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < FRAMES; ++i)
+        brutePairs = bruteForce(hitboxes);
+    double brute = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / FRAMES;
+
+    std::size_t hashPairs = 0;
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < FRAMES; ++i)
+        hashPairs = broadPhase(hash, hitboxes, pairs);
+    double hashed = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / FRAMES;
+
+    std::cout << std::right << std::setw(6) << count << " entities"
+              << std::setw(12) << std::fixed << std::setprecision(3) << brute << " ms (every pair)"
+              << std::setw(12) << hashed << " ms (spatial hash)"
+              << std::setw(8) << hashPairs << " pairs"
+              << (hashPairs == brutePairs ? "" : " MISMATCH") << std::endl;
+}
+
+}
+
+int main()
+{
+    std::cout << "Intersecting hitboxes per frame (average of " << FRAMES << " frames)" << std::endl;
+
+    benchmark(100);
+    benchmark(1000);
+    benchmark(10000);
+
+    return 0;
+}
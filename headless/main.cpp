@@ -0,0 +1,53 @@
+#include "../src/headers.h"
+#include "../src/Game.h"
+#include "../src/Simulation/World.h"
+#include "../src/Simulation/InputScript.h"
+
+// Runs the game logic without any window : map, player, demons and collisions with scripted inputs and a fixed step
+// Usage : headless [seed] [steps] [script]
+// Without a script, the player walks randomly (moves chosen from the seed)
+
+namespace
+{
+
+const int RANDOM_MOVES = 64;
+const int STEPS_PER_MOVE = 120;         // One second per move
+
+}
+
+int main(int argc, char** argv)
+{
+    int seed = argc > 1 ? std::stoi(argv[1]) : 1;
+    std::size_t steps = argc > 2 ? std::stoul(argv[2]) : 7200;
+
+    InputScript script;
+    if (argc > 3)
+        script.load(argv[3]);
+    else
+        script = InputScript::createRandomWalk(static_cast<std::uint64_t>(seed), RANDOM_MOVES, STEPS_PER_MOVE);
+
+    auto start = std::chrono::steady_clock::now();
+    World world(sf::Vector2f(1280.0f, 720.0f), seed, World::HEADLESS);
+    world.getMap().waitForLoading();
+    double loading = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t step = 0; step < steps; ++step)
+    {
+        script.apply(world.getPlayer(), step);
+        world.update(Game::TIME_STEP);
+    }
+    double total = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    const Vector& position = world.getPlayer().getPosition();
+    std::cout << std::fixed << std::setprecision(3)
+              << "seed " << seed << ", " << steps << " steps (" << static_cast<float>(steps) * Game::TIME_STEP << " s simulated)\n"
+              << "loading      : " << loading << " ms\n"
+              << "update       : " << total / static_cast<double>(std::max<std::size_t>(steps, 1)) << " ms/step\n"
+              << "chunks       : " << world.getMap().getNumberOfChunks() << "\n"
+              << "demons       : " << world.getDemonSpawner().getEntities().size() << "\n"
+              << "player       : " << position.getX() << " " << position.getY() << "\n"
+              << "state hash   : " << std::hex << world.getStateHash() << std::dec << "\n";
+
+    return 0;
+}
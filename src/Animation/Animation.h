@@ -3,26 +3,25 @@
 
 #include "../Drawable.h"
 
-class Animation
-{
-public:
+// Compact identifier of an animation clip (index in the animation table)
+typedef std::uint16_t ClipID;
 
-    Animation(sf::Sprite& sprite, sf::Texture& textureSheet, float animationTimer, sf::Vector2i startFrame, sf::Vector2i numbersOfFrames, sf::Vector2i size);
-    
-    void play(const float& dt, const float& percentageSpeed = 0.01f);
-    void pause();
-    void reset();
-    bool isDone();
+// Frames of an animation in a texture sheet (one row), shared by every entity playing it
+struct AnimationClip
+{
+    std::string name;
+    sf::Vector2i start;         // First frame (in frames)
+    int frames;                 // Number of frames
+    sf::Vector2i frameSize;     // Size of a frame (in pixels)
+    float frameTime;            // Time a frame is shown at full speed (in seconds)
+};
 
-private:
-    // Variables
-    sf::Sprite& sprite_;
-    sf::Texture& textureSheet_;
-    sf::IntRect startRect_, endRect_, currentRect_;
-    
-    Vector size_;
-    float animationTimer_;
-    float timer_;
-    bool done_;
+// Animation state of an entity : the only animation data stored per entity
+struct AnimationState
+{
+    ClipID clip;
+    std::uint16_t frame;
+    float timer;
 };
-#endif
\ No newline at end of file
+
+#endif
@@ -3,45 +3,69 @@
 
 /**
  * @brief Constructor
- * @param textureSheet  Texture sheet of the animation  
+ * @param sprite        Sprite where the animation will be applied
+ * @param sheet         Sprite sheet of the animation (in an atlas)
+ * @param clip          Clip shown first
  */
-AnimationComponent::AnimationComponent(sf::Sprite& sprite, sf::Texture& textureSheet)
-    :   sprite_(sprite),
-        textureSheet_(textureSheet)
-{}
+AnimationComponent::AnimationComponent(sf::Sprite& sprite, const TextureRegion& sheet, ClipID clip)
+    :   state_(AnimationTable::start(clip)),
+        done_(false),
+        sprite_(sprite),
+        origin_(sheet.rect.left, sheet.rect.top)
+{
+    if (sheet.texture)
+        sprite_.setTexture(*sheet.texture, true);
+    sprite_.setTextureRect(getTextureRect());
+}
 
 /**
- * @brief Method that plays the animation component
+ * @brief Method that plays a clip (from its first frame if another clip was playing)
  * The current speed and the max speed are used to slow 
  * down the animation depending on the entity's speed
- * @param animationName Name of the animation to play
+ * @param clip          Clip to play
  * @param dt            Time since last frame
  * @param currentSpeed  Current speed of the entity
  * @param maxSpeed      Maximum speed of the entity
  */
-void AnimationComponent::playAnimation(std::string animationName, const float& dt, const float& currentSpeed, const float& maxSpeed)
+void AnimationComponent::playAnimation(ClipID clip, const float& dt, const float& currentSpeed, const float& maxSpeed)
 {
-    if (lastAnimation_ != animations_[animationName])
-    {
-        if (lastAnimation_ != nullptr)
-            lastAnimation_->reset();
-        lastAnimation_ = std::make_unique<Animation>(*animations_[animationName]);
-    }
+    bool changed = state_.clip != clip;
+    if (changed)
+        state_ = AnimationTable::start(clip);
+
+    std::uint16_t frame = state_.frame;
+    done_ = AnimationTable::advance(state_, dt, std::abs(currentSpeed) / maxSpeed);
 
-    animations_[animationName]->play(dt, static_cast<float>(abs(static_cast<int>(currentSpeed))) / maxSpeed);
+    // The texture rectangle only changes with the frame
+    if (changed || state_.frame != frame)
+        sprite_.setTextureRect(getTextureRect());
 }
 
-void AnimationComponent::addAnimation(const std::string& animationName, float animationTimer, sf::Vector2i startFrame, sf::Vector2i numbersOfFrames, sf::Vector2i size)
+/**
+ * @brief Method that restarts the clip played
+ */
+void AnimationComponent::resetAnimation()
 {
-    animations_[animationName] = std::make_unique<Animation>(sprite_, textureSheet_, animationTimer, startFrame, numbersOfFrames, size);
+    state_ = AnimationTable::start(state_.clip);
+    sprite_.setTextureRect(getTextureRect());
 }
 
 /**
- * @brief Method that resets a certain animation
- * @param animationName Name of the animation to reset
+ * @brief Method that returns whether the clip has just started over
+ * @return      Done or not
  */
-void AnimationComponent::resetAnimation(const std::string& animationName)
+bool AnimationComponent::isDone() const
 {
-    animations_[animationName]->reset();
+    return done_;
 }
 
+/**
+ * @brief Method that returns the rectangle of the current frame in the texture
+ */
+sf::IntRect AnimationComponent::getTextureRect() const
+{
+    sf::IntRect rect = AnimationTable::getTextureRect(state_);
+    rect.left += origin_.x;
+    rect.top += origin_.y;
+    return rect;
+}
@@ -2,26 +2,29 @@
 #define ANIMATION_COMPONENT_H
 
 #include "../Drawable.h"
-#include "Animation.h"
-
+#include "AnimationTable.h"
+#include "../Render/TextureAtlas.h"
 
+// Animation of a sprite : the clip played is taken from the animation table
 class AnimationComponent
 {
 
 public:
-    AnimationComponent(sf::Sprite& sprite, sf::Texture& textureSheet);
+    AnimationComponent(sf::Sprite& sprite, const TextureRegion& sheet, ClipID clip);
 
-    void addAnimation(const std::string& animationName, float animationTimer, sf::Vector2i startFrame, sf::Vector2i numbersOfFrames, sf::Vector2i size);
-    void playAnimation(std::string animationName, const float& dt, const float& currentSpeed = 1.0f, const float& maxSpeed = 1.0f);
-    void resetAnimation(const std::string& animationName);
+    void playAnimation(ClipID clip, const float& dt, const float& currentSpeed = 1.0f, const float& maxSpeed = 1.0f);
+    void resetAnimation();
+    bool isDone() const;
 
 private:
 
-    std::map<std::string, std::unique_ptr<Animation>> animations_;
-    std::unique_ptr<Animation> lastAnimation_;
+    sf::IntRect getTextureRect() const;
+
+    AnimationState state_;
+    bool done_;
     sf::Sprite& sprite_;
-    sf::Texture& textureSheet_;
+    sf::Vector2i origin_;       // Top left corner of the sprite sheet in its texture
 
 };
 
-#endif
\ No newline at end of file
+#endif
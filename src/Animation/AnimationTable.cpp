@@ -0,0 +1,100 @@
+#include "../headers.h"
+#include "AnimationTable.h"
+
+/**
+ * @brief Function that returns the singleton
+ * @return              Animation table
+ */
+AnimationTable& AnimationTable::getInstance()
+{
+    static AnimationTable instance;
+    return instance;
+}
+
+/**
+ * @brief Constructor
+ */
+AnimationTable::AnimationTable()
+{
+    loadClips();
+}
+
+/**
+ * @brief Destructor
+ */
+AnimationTable::~AnimationTable()
+{
+
+}
+
+/**
+ * @brief Function that loads every clip into the table and gives them an ID
+ * Format of a line : name startX startY frames frameWidth frameHeight frameTime
+ */
+void AnimationTable::loadClips()
+{
+    std::ifstream file("config/animations.ini");
+    AnimationClip clip;
+
+    while (file >> clip.name >> clip.start.x >> clip.start.y >> clip.frames
+                >> clip.frameSize.x >> clip.frameSize.y >> clip.frameTime)
+    {
+        if (clip.frames < 1)
+            clip.frames = 1;
+
+        ids_.emplace(clip.name, static_cast<ClipID>(clips_.size()));
+        clips_.push_back(clip);
+    }
+
+    if (clips_.empty())
+        throw("Error : Could not load the animations");
+}
+
+/**
+ * @brief Function that returns the ID of a clip from its name
+ * Names are only used when loading, IDs are used everywhere else
+ * @param name          Name of the clip @see animations.ini
+ */
+ClipID AnimationTable::I_getID(const std::string& name) const
+{
+    const auto& id = ids_.find(name);
+    if (id == ids_.end())
+    {
+        std::cout << "Animation : " << name << "\n";
+        throw("Error : Animation not found");
+    }
+
+    return id->second;
+}
+
+/**
+ * @brief Function that advances an animation
+ * @param state         Animation state of the entity
+ * @param dt            Time since the last update
+ * @param speed         Fraction of the full speed of the clip
+ * @return              Whether the clip has started over
+ */
+bool AnimationTable::I_advance(AnimationState& state, const float& dt, const float& speed) const
+{
+    const AnimationClip& clip = clips_[state.clip];
+
+    state.timer += dt * speed;
+    if (state.timer < clip.frameTime)
+        return false;
+
+    state.timer -= clip.frameTime;
+    state.frame = static_cast<std::uint16_t>((state.frame + 1) % clip.frames);
+    return state.frame == 0;
+}
+
+/**
+ * @brief Function that returns the rectangle of the current frame in the texture sheet
+ * @param state         Animation state of the entity
+ */
+sf::IntRect AnimationTable::I_getTextureRect(const AnimationState& state) const
+{
+    const AnimationClip& clip = clips_[state.clip];
+    return sf::IntRect(
+        (clip.start.x + state.frame) * clip.frameSize.x, clip.start.y * clip.frameSize.y,
+        clip.frameSize.x, clip.frameSize.y);
+}
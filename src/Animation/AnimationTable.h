@@ -0,0 +1,57 @@
+#ifndef ANIMATION_TABLE_H
+#define ANIMATION_TABLE_H
+
+#include "Animation.h"
+
+// Singleton class : every animation clip, loaded once from animations.ini
+// Clips are looked up by name when loading and by ID everywhere else
+class AnimationTable
+{
+public:
+
+    AnimationTable(const AnimationTable&) = delete;
+    void operator=(const AnimationTable&) = delete;
+
+    static ClipID getID(const std::string& name)
+    {
+        return getInstance().I_getID(name);
+    }
+
+    static const AnimationClip& getClip(ClipID id)
+    {
+        return getInstance().clips_[id];
+    }
+
+    static AnimationState start(ClipID id)
+    {
+        return AnimationState { id, 0, 0.0f };
+    }
+
+    static bool advance(AnimationState& state, const float& dt, const float& speed = 1.0f)
+    {
+        return getInstance().I_advance(state, dt, speed);
+    }
+
+    static sf::IntRect getTextureRect(const AnimationState& state)
+    {
+        return getInstance().I_getTextureRect(state);
+    }
+
+    static AnimationTable& getInstance();
+    virtual ~AnimationTable();
+
+private:
+
+    AnimationTable();
+
+    void loadClips();
+    ClipID I_getID(const std::string& name) const;
+    bool I_advance(AnimationState& state, const float& dt, const float& speed) const;
+    sf::IntRect I_getTextureRect(const AnimationState& state) const;
+
+    // Clips indexed by their ID
+    std::vector<AnimationClip> clips_;
+    std::unordered_map<std::string, ClipID> ids_;
+};
+
+#endif
@@ -2,12 +2,13 @@
 #define DRAWABLE_H
 
 #include "Math/Vector.h"
+#include "Render/RenderSnapshot.h"
 
 class Drawable
 {
 public:
     virtual void update(const float& dt) = 0;
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr) = 0;
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr) = 0;
 };
 
 #endif
\ No newline at end of file
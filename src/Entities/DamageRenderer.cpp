@@ -27,7 +27,7 @@ void DamageRenderer::I_update(const float& dt)
  * @brief Function that draws every damage number on the window
  * @param window    Window where the numbers will be drawn
  */
-void DamageRenderer::I_render(std::shared_ptr<sf::RenderTarget> target)
+void DamageRenderer::I_render(std::shared_ptr<RenderSnapshot> target)
 {
     for (const auto& damageText : damageTexts_)
     {
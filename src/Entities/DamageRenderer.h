@@ -32,7 +32,7 @@ public:
     static void update(const float& dt)
         { getInstance().I_update(dt); };
 
-    static void render(std::shared_ptr<sf::RenderTarget> target)
+    static void render(std::shared_ptr<RenderSnapshot> target)
         { getInstance().I_render(target); };
 
     static void addDamage(float value, const Vector& position)
@@ -48,7 +48,7 @@ private:
     virtual ~DamageRenderer() {};
 
     static void I_update(const float& dt);
-    static void I_render(std::shared_ptr<sf::RenderTarget> target);
+    static void I_render(std::shared_ptr<RenderSnapshot> target);
     static void I_addDamage(float value, const Vector& position);
 
     static sf::Font font_;
@@ -2,134 +2,79 @@
 #include "Demon.h"
 
 /**
- * @brief Constructor with parameters
- * @param position              Position
- * @param size                  Size
- * @param attractor             Reference to position to follow
- * @param movementComponents    Movement component of the Demon containing its acceleration and all
- * @param texture               Texture of the demon
+ * @brief Constructor
+ * @param registry      Registry storing the demon
+ * @param index         Index of the demon in the registry
  */
-Demon::Demon(const Vector& position, const Vector& size, const Vector& attractor, MovementComponents movementComponents, std::shared_ptr<sf::Texture> texture)
-    :   MovableEntity(position, size, movementComponents, 50.0f)
-    ,   attractor_(attractor)
+Demon::Demon(EntityRegistry& registry, EntityRegistry::Index index)
+    :   registry_(registry)
+    ,   index_(index)
 {
 
-    // Creating the hitbox component with an offset and a different size than the sprite
-    createHitboxComponent(sprite_, Vector(0, 0), Vector(32, 32));
-
-    if (texture != nullptr)
-        addTexture(texture);
 }
 
 /**
- * @brief Copy Constructor
- * @param demon     Demon to copy
+ * @brief Destructor
  */
-Demon::Demon(const Demon& demon)
-    :   MovableEntity(demon.position_, demon.size_, demon.movementComponents_)
-    ,   attractor_(demon.attractor_)
+Demon::~Demon()
 {
-    sprite_ = demon.sprite_;
 
-    // Creating the hitbox component with an offset and a different size than the sprite
-    createHitboxComponent(sprite_, Vector(0, 0), Vector(32, 32));
 }
 
 /**
- * @brief Destructor
+ * @brief Function that damages the demon
+ * @param value     Life removed
  */
-Demon::~Demon()
+void Demon::damage(float value)
 {
-
+    registry_.damage(index_, value);
 }
 
 /**
- * @brief Function that updates the Demon's position, size, ...
- * @param dt        Time since last frame
+ * @brief Function that returns the position of the demon
  */
-void Demon::update(const float& dt)
+const Vector& Demon::getPosition() const
 {
-    if (!damaged_)
-    {
-        attract();
-    }
-    
-    updateMovement(dt);
-    updateDamage();
-    hitboxComponent_->update(dt); 
- 
-    updateAnimations(dt);
+    return registry_.getPosition(index_);
 }
 
 /**
- * @brief Function that draws the Demon on the window
- * @param window    Window where the Demon will be drawn into
+ * @brief Function that returns the hitbox of the demon
  */
-void Demon::render(std::shared_ptr<sf::RenderTarget> target)
+const sf::FloatRect& Demon::getHitbox() const
 {
-    if (damaged_)
-    {
-        sprite_.setColor(sf::Color::Red);
-        hitboxComponent_->setOutlineColor(sf::Color::Yellow);
-    }
-    else
-    {
-        sprite_.setColor(sf::Color::White);
-        hitboxComponent_->setOutlineColor(sf::Color::Red);
-    }
-    
-    target->draw(sprite_);
-    hitboxComponent_->render(target);
+    return registry_.getHitbox(index_);
 }
 
 /**
- * @brief Function that adds a texture to the Demon (with the animations)
- * @param texture   Texture
+ * @brief Function that returns the life of the demon
  */
-void Demon::addTexture(std::shared_ptr<sf::Texture> texture_)
+float Demon::getLife() const
 {
-
-    // Adding the texture to the sprite
-    Entity::addTexture(texture_);
-
-    createAnimationComponent(*texture_);
-    
-    // Adding the animations
-    initializeAnimations();
-
+    return registry_.getLife(index_);
 }
 
 /**
- * @brief Function that attracts the demon to the attractor
+ * @brief Function that returns the experience given to the player when the demon is hit
  */
-void Demon::attract()
+float Demon::getExperience() const
 {
-    Vector dp = attractor_ - (position_) - size_ * 0.25f;
-    if (dp.norm() > 1.0f)
-        velocity_ = (dp / (dp.norm())) * movementComponents_.maxSpeed_;
-    else
-        velocity_ = 0;
+    return registry_.getArchetype(registry_.getKind(index_)).experience;
 }
 
 /**
- * @brief Method that generates every animation needed the player
+ * @brief Function that returns whether the demon was hit recently
  */
-void Demon::initializeAnimations()
+bool Demon::isDamaged() const
 {
-    animationComponent_->addAnimation(
-        "MOVE",
-        10.0f,
-        sf::Vector2i(0, 0),
-        sf::Vector2i(1, 0),
-        sf::Vector2i(32, 32)
-    );
+    return registry_.isDamaged(index_);
 }
 
 /**
- * @brief Method that updates the animation according to the velocity
- * @param dt    Time since last frame
+ * @brief Function that changes the velocity of the demon
+ * @param velocity  Velocity
  */
-void Demon::updateAnimations(const float& dt)
+void Demon::setVelocity(const Vector& velocity)
 {
-    animationComponent_->playAnimation("MOVE", dt);
-}
\ No newline at end of file
+    registry_.setVelocity(index_, velocity);
+}
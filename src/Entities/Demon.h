@@ -1,31 +1,32 @@
 #ifndef DEMON_H
 #define DEMON_H
 
-#include "MovableEntity.h"
+#include "EntityRegistry.h"
 
+// Handle on a demon stored in an entity registry (valid until the registry removes entities)
 class Demon
-    :   public MovableEntity
 {
 
 public:
-    Demon(const Vector& position, const Vector& size, const Vector& attractor, MovementComponents movementComponents, std::shared_ptr<sf::Texture> texture = nullptr);
-    Demon(const Demon& demon);
-    virtual ~Demon();
+    Demon(EntityRegistry& registry, EntityRegistry::Index index);
+    ~Demon();
 
-    virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target);
-    virtual void addTexture(std::shared_ptr<sf::Texture> texture_);
+    void damage(float value);
 
-    virtual float getExperience()
-        { return 0.2f; };
+    // Getters
+    const Vector& getPosition() const;
+    const sf::FloatRect& getHitbox() const;
+    float getLife() const;
+    float getExperience() const;
+    bool isDamaged() const;
 
-private:
+    // Setters
+    void setVelocity(const Vector& velocity);
 
-    virtual void attract();
-    virtual void initializeAnimations();
-    virtual void updateAnimations(const float& dt);
+private:
 
-    const Vector& attractor_;
+    EntityRegistry& registry_;
+    EntityRegistry::Index index_;
 };
 
-#endif
\ No newline at end of file
+#endif
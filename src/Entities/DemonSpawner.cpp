@@ -1,23 +1,27 @@
 #include "../headers.h"
 #include "DemonSpawner.h"
+#include "../Map/CollisionHandler.h"
+#include "../Profiling/Profiler.h"
 
 /**
  * @brief Constructor
  * @param   position        Position to follow (of the player)
  * @param   spawningRadius  Radius in which the entities will spawn
- * @param   demon           Demon template for spawning
- * @param   maxEntities     Maximum of entities that can be spawned 
+ * @param   demon           Values shared by the demons spawned
+ * @param   maxEntities     Maximum of entities that can be spawned (EntityRegistry::DEFAULT_CAPACITY if not positive)
+ * @param   seed            Seed of the spawning positions
  */
-DemonSpawner::DemonSpawner(const Vector& position, const float spawningRadius, const Demon& demon, const int maxEntities)
+DemonSpawner::DemonSpawner(const Vector& position, const float spawningRadius, const EntityArchetype& demon, const int maxEntities, std::uint64_t seed)
     :   spawningRadius_(spawningRadius)
     ,   position_(position)
-    ,   m_Demon(demon)
     ,   maxEntities_(maxEntities)
+    ,   spawningTimer_(0.0f)
+    ,   random_(seed, Random::DEMON_SPAWNER)
+    ,   entities_(maxEntities > 0 ? static_cast<std::size_t>(maxEntities) : EntityRegistry::DEFAULT_CAPACITY)
+    ,   kind_(entities_.addArchetype(demon))
+    ,   alpha_(1.0f)
 {
-    spawningClock_.restart();
 
-    if (maxEntities_ > 0)
-        entities_.reserve(maxEntities_ * sizeof(Demon));
 }
 
 /**
@@ -34,82 +38,134 @@ DemonSpawner::~DemonSpawner()
  */
 void DemonSpawner::update(const float& dt)
 {
-    if (spawningClock_.getElapsedTime().asSeconds() >= 1)
-    {
-        spawningClock_.restart();
-        if (maxEntities_ > 0 && entities_.size() < maxEntities_ ||
-            maxEntities_ <= 0)
-            spawn();
-    }
+    ProfileZone zone("DemonSpawner::update");
 
-    for (auto& entity : entities_)
+    spawningTimer_ += dt;
+    if (spawningTimer_ >= SPAWNING_PERIOD)
     {
-        entity->update(dt);
+        spawningTimer_ -= SPAWNING_PERIOD;
+        if (!entities_.isFull())
+            spawn();
     }
 
-    
+    entities_.attract(position_);
+    entities_.move(dt);
+    entities_.updateDamage(dt);
+    entities_.updateHitboxes();
+    entities_.animate(dt);
 }
 
-
 /**
  * @brief Function that renders the entities generated by the spawner
  * @param target            Where to draw the entities
  */
-void DemonSpawner::render(std::shared_ptr<sf::RenderTarget> target)
+void DemonSpawner::render(std::shared_ptr<RenderSnapshot> target)
 {
-    for (const auto& entity : entities_)
-    {
-        entity->render(target);
-    }
+    entities_.render(target, alpha_);
+}
+
+/**
+ * @brief Function that places the entities between the last two simulation steps
+ * @param alpha             Time since the last step (fraction of a step)
+ */
+void DemonSpawner::interpolate(const float& alpha)
+{
+    alpha_ = alpha;
 }
 
 /**
- * @brief Function that adds a texture to the entities
- * @param texture       Texture to add
+ * @brief Function that adds a sprite sheet to the entities
+ * @param sheet         Sprite sheet (in an atlas)
  */
-void DemonSpawner::addTexture(std::shared_ptr<sf::Texture>& texture)
+void DemonSpawner::addTexture(const TextureRegion& sheet)
 {
-    texture_ = texture;
-    m_Demon.addTexture(texture);
+    entities_.getArchetype(kind_).sheet = sheet;
 }
 
 /**
- * @brief Function that collides the player with the demons
+ * @brief Function that collides the player with the demons (after the terrain pass : hitboxes at their final position)
  * @param player        Player
  */
 void DemonSpawner::collide(Player& player) 
 {
+    ProfileZone zone("DemonSpawner::collide");
 
-    for (auto it = entities_.begin(); it != entities_.end(); ++it)
-    {
-        auto& entity = *it;
-        EntityCollider::handleCollisionPE(&player, entity.get());
+    buildBroadPhase();
 
-        if (entity->getLife() <= 0)
-            entities_.erase(it);
+    // Narrow phase only for the demons near the sword
+    if (player.isAttacking())
+    {
+        broadPhase_.query(player.getSword().getHitbox().getHitbox(), candidates_);
+        for (SpatialHash::ID id : candidates_)
+        {
+            EntityCollider::handleCollisionPE(&player, Demon(entities_, id));
+        }
     }
+
+    entities_.removeDead();
 }
 
 /**
- * @brief Function that spawns an entity
+ * @brief Function that adds the demons to the terrain collision pass
+ * @param bodies        Bodies of every entity colliding with the terrain
  */
-void DemonSpawner::spawn()
+void DemonSpawner::addTerrainBodies(std::vector<TerrainBody>& bodies) const
 {
-    // Find a position in the radius
-    srand(time(0));
-    float angle = rand() % 360;
-    Vector pos(static_cast<float>(cos(angle)) * spawningRadius_, static_cast<float>(sin(angle)) * spawningRadius_);
-
-    entities_.push_back(std::make_unique<Demon>(m_Demon));
-    
-    if (texture_ != nullptr)
-        entities_[entities_.size() - 1]->addTexture(texture_);
-    
-    entities_[entities_.size() - 1]->setPosition(pos + position_);
+    entities_.addTerrainBodies(bodies);
 }
 
+/**
+ * @brief Function that applies the result of the terrain collision pass to the demons
+ * @param bodies        Bodies of the demons (same order as added by addTerrainBodies)
+ */
+void DemonSpawner::applyTerrainCollision(const TerrainBody* bodies)
+{
+    entities_.applyTerrainCollision(bodies);
+}
 
+/**
+ * @brief Function that registers the hitbox of every demon in the broad phase
+ */
+void DemonSpawner::buildBroadPhase()
+{
+    broadPhase_.clear();
+    for (const sf::FloatRect& hitbox : entities_.getHitboxes())
+    {
+        broadPhase_.insert(hitbox);
+    }
+    broadPhase_.build();
+}
 
+/**
+ * @brief Function that pushes apart the demons overlapping each other (half the overlap each)
+ * Called before the terrain pass, which pushes the demons out of the blocks they were pushed into
+ */
+void DemonSpawner::separate()
+{
+    ProfileZone zone("DemonSpawner::separate");
 
+    buildBroadPhase();
+    broadPhase_.findPairs(pairs_);
+    for (const SpatialHash::Pair& pair : pairs_)
+    {
+        Vector offset = CollisionHandler::collide(broadPhase_.getRect(pair.first), broadPhase_.getRect(pair.second)) * 0.5f;
 
+        entities_.translate(pair.first, offset);
+        entities_.translate(pair.second, offset * -1.0f);
+    }
 
+    if (!pairs_.empty())
+        entities_.updateHitboxes();
+}
+
+/**
+ * @brief Function that spawns an entity
+ */
+void DemonSpawner::spawn()
+{
+    // Find a position in the radius
+    float angle = random_.nextFloat(0.0f, 2.0f * static_cast<float>(M_PI));
+    Vector pos(std::cos(angle) * spawningRadius_, std::sin(angle) * spawningRadius_);
+
+    entities_.create(kind_, pos + position_);
+}
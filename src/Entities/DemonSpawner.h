@@ -4,33 +4,54 @@
 #include "Demon.h"
 #include "EntityCollider.h"
 #include "Player.h"
+#include "SpatialHash.h"
 #include "../Math/Vector.h"
+#include "../Math/Random.h"
 
 class DemonSpawner
     :   public Drawable
 {
 public:
-    DemonSpawner(const Vector& position, const float spawningRadius, const Demon& demon, const int maxEntities = -1);
+
+    static constexpr float SPAWNING_PERIOD = 1.0f;      // Time between two spawns (in seconds)
+
+    DemonSpawner(const Vector& position, const float spawningRadius, const EntityArchetype& demon, const int maxEntities = -1,
+            std::uint64_t seed = Random::createSeed());
     ~DemonSpawner();
 
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
-    virtual void addTexture(std::shared_ptr<sf::Texture>& texture);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
+    virtual void interpolate(const float& alpha);
+    virtual void addTexture(const TextureRegion& sheet);
+    virtual void separate();
     virtual void collide(Player& player);
+    virtual void addTerrainBodies(std::vector<TerrainBody>& bodies) const;
+    virtual void applyTerrainCollision(const TerrainBody* bodies);
+
+    const EntityRegistry& getEntities() const
+        { return entities_; };
 
 private:
 
     virtual void spawn();
+    virtual void buildBroadPhase();
 
     const float spawningRadius_;
     const Vector& position_;
-    Demon m_Demon;
     const int maxEntities_;
     
-    sf::Clock spawningClock_;
-
-    std::vector<std::unique_ptr<Demon>> entities_;
-    std::shared_ptr<sf::Texture> texture_;
+    float spawningTimer_;       // Simulated time (same spawns for the same steps and seed)
+    RandomStream random_;
+
+    // Demons (struct of arrays reserved for maxEntities_) and their kind
+    EntityRegistry entities_;
+    EntityRegistry::Kind kind_;
+    float alpha_;
+
+    // Broad phase of the collisions (ID of a demon = index in entities_), rebuilt every frame
+    SpatialHash broadPhase_;
+    std::vector<SpatialHash::Pair> pairs_;
+    std::vector<SpatialHash::ID> candidates_;
 };
 
 #endif
\ No newline at end of file
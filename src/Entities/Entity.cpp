@@ -20,6 +20,7 @@ void Entity::initShape()
  */
 Entity::Entity(Vector position, Vector size)
     :   position_(position)
+    ,   previousPosition_(position)
     ,   size_(size)
 {
     center_ = position_ + size_ * 0.5f;
@@ -35,21 +36,26 @@ Entity::~Entity()
 }
 
 /**
- * @brief Function that adds a texture to the button (changes the sprite too)
- * @param texture   Shared pointer pointing to the texture
+ * @brief Function that adds a sprite sheet to the entity (changes the sprite too)
+ * @param sheet     Sprite sheet (in an atlas)
  */
-void Entity::addTexture(std::shared_ptr<sf::Texture> texture)
+void Entity::addTexture(const TextureRegion& sheet)
 {
-    sprite_.setTexture(*texture);
+    sheet_ = sheet;
+
+    // No texture without a window (headless simulation) : only the animations are updated
+    if (sheet_.texture)
+        sprite_.setTexture(*sheet_.texture);
+    sprite_.setTextureRect(sheet_.rect);
 }
 
 /**
  * @brief Method that creates the animation component
- * @param textureSheet  Texture sheet to use for the animations
+ * @param clip          Clip shown first (in the sprite sheet of the entity)
  */
-void Entity::createAnimationComponent(sf::Texture& textureSheet)
+void Entity::createAnimationComponent(ClipID clip)
 {
-    animationComponent_ = std::make_unique<AnimationComponent>(sprite_, textureSheet);
+    animationComponent_ = std::make_unique<AnimationComponent>(sprite_, sheet_, clip);
 }
 
 /**
@@ -63,6 +69,27 @@ void Entity::createHitboxComponent(sf::Sprite& sprite, const Vector& offset, con
     hitboxComponent_ = std::make_unique<HitboxComponent>(sprite, offset, size);
 }
 
+/**
+ * @brief Function that places the sprite between the last two simulation steps
+ * The next update places it back at the simulated position
+ * @param alpha     Time since the last step (fraction of a step)
+ */
+void Entity::interpolate(const float& alpha)
+{
+    Vector position = getInterpolatedPosition(alpha);
+    rect_.setPosition(position.getAsVector2f());
+    sprite_.setPosition(position.getAsVector2f());
+}
+
+/**
+ * @brief Function that places the sprite back at the simulated position (undoes interpolate)
+ */
+void Entity::restorePosition()
+{
+    rect_.setPosition(position_.getAsVector2f());
+    sprite_.setPosition(position_.getAsVector2f());
+}
+
 /**
  * @brief Function that returns the entity's position
  * @return position
@@ -89,6 +116,15 @@ const Vector& Entity::getCenter() const
     return center_;
 }
 
+/**
+ * @brief Function that returns the position between the last two simulation steps
+ * @param alpha     Time since the last step (fraction of a step)
+ */
+Vector Entity::getInterpolatedPosition(const float& alpha) const
+{
+    return previousPosition_ + (position_ - previousPosition_) * alpha;
+}
+
 /**
  * @brief Function that returns the hitbox of the player
  * @return hitbox
@@ -99,12 +135,13 @@ const HitboxComponent& Entity::getHitbox() const
 }
 
 /**
- * @brief Function that changes the entity's position
+ * @brief Function that changes the entity's position (not interpolated)
  * @param position      New position
  */
 void Entity::setPosition(const Vector& position)
 {
     position_ = position;
+    previousPosition_ = position;
 }
 
 /**
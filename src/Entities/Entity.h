@@ -16,16 +16,19 @@ public:
     virtual ~Entity();
 
     virtual void update(const float& dt) = 0;
-    virtual void render(std::shared_ptr<sf::RenderTarget> window) = 0;
-    virtual void addTexture(std::shared_ptr<sf::Texture> texture_);
-    virtual void createAnimationComponent(sf::Texture& textureSheet);
+    virtual void render(std::shared_ptr<RenderSnapshot> window) = 0;
+    virtual void addTexture(const TextureRegion& sheet);
+    virtual void createAnimationComponent(ClipID clip);
     virtual void createHitboxComponent(sf::Sprite& sprite, const Vector& offset, const Vector& size);
+    virtual void interpolate(const float& alpha);
+    virtual void restorePosition();
 
     // Getters
     const Vector& getPosition() const;
     const Vector& getSize() const;
     const HitboxComponent& getHitbox() const;
     const Vector& getCenter() const;
+    Vector getInterpolatedPosition(const float& alpha) const;
 
     // Setters
     void setPosition(const Vector& position);
@@ -34,6 +37,7 @@ public:
 protected:
 
     Vector position_;
+    Vector previousPosition_;       // Position before the last simulation step (rendering between two steps)
     Vector size_;
     Vector center_;
 
@@ -44,6 +48,7 @@ protected:
     // Drawable
     sf::RectangleShape rect_;
     sf::Sprite sprite_;
+    TextureRegion sheet_;           // Sprite sheet of the animations (kept alive while the entity uses it)
 
 private:
     
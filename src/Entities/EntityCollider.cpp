@@ -26,3 +26,21 @@ void EntityCollider::handleCollisionPE(Player* player, MovableEntity* collider)
     }
 
 }
+
+/**
+ * @brief Function that handles the collision between the player and a demon
+ * @param   player      player
+ * @param   collider    Demon colliding with player
+ */
+void EntityCollider::handleCollisionPE(Player* player, Demon collider)
+{
+    if (player->isAttacking() && player->getSword().isIntersecting(collider.getHitbox()) && !collider.isDamaged())
+    {
+        collider.damage(player->getSword().getAttackDamage());
+        collider.setVelocity(player->getSword().getMouseDirection() * knockbackCoefficientPE_);
+
+        DamageRenderer::addDamage(player->getSword().getAttackDamage(), collider.getPosition());
+
+        player->addExperience(collider.getExperience());
+    }
+}
@@ -2,6 +2,7 @@
 #define ENTITY_COLLIDER_H
 
 #include "Player.h"
+#include "Demon.h"
 #include "DamageRenderer.h"
 #include "../HUD/ExperienceBar.h"
 
@@ -9,6 +10,7 @@ class EntityCollider
 {
 public:
     static void handleCollisionPE(Player* player, MovableEntity* collider);
+    static void handleCollisionPE(Player* player, Demon collider);
 
 private:
     static bool detectCollision();
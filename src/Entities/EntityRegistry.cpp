@@ -0,0 +1,443 @@
+#include "../headers.h"
+#include "EntityRegistry.h"
+
+/**
+ * @brief Constructor (reserves every array)
+ * @param capacity      Maximum number of entities
+ */
+EntityRegistry::EntityRegistry(std::size_t capacity)
+    :   capacity_(capacity)
+    ,   slots_(capacity)
+    ,   firstFreeSlot_(capacity > 0 ? 0 : NO_SLOT)
+{
+    // Every slot is free, each one linked to the next
+    for (std::size_t i = 0; i < capacity; ++i)
+        slots_[i] = { i + 1 < capacity ? static_cast<std::uint32_t>(i + 1) : NO_SLOT, 0 };
+
+    slotIndices_.reserve(capacity);
+    kinds_.reserve(capacity);
+    positions_.reserve(capacity);
+    previousPositions_.reserve(capacity);
+    velocities_.reserve(capacity);
+    movements_.reserve(capacity);
+    hitboxes_.reserve(capacity);
+    lives_.reserve(capacity);
+    damageTimers_.reserve(capacity);
+    animations_.reserve(capacity);
+}
+
+/**
+ * @brief Destructor
+ */
+EntityRegistry::~EntityRegistry()
+{
+
+}
+
+/**
+ * @brief Function that adds a kind of entity
+ * @param archetype     Values shared by the entities of the kind
+ * @return              Kind to create the entities with
+ */
+EntityRegistry::Kind EntityRegistry::addArchetype(const EntityArchetype& archetype)
+{
+    archetypes_.push_back(archetype);
+    archetypes_.back().spawnAnimation = AnimationTable::start(archetype.clip);
+    return static_cast<Kind>(archetypes_.size() - 1);
+}
+
+/**
+ * @brief Function that creates an entity (the registry must not be full)
+ * @param kind          Kind of the entity (see addArchetype)
+ * @param position      Position
+ * @return              Handle of the entity
+ */
+EntityHandle EntityRegistry::create(Kind kind, const Vector& position)
+{
+    if (firstFreeSlot_ == NO_SLOT)
+        throw("EntityRegistry : no entity left to create");
+
+    const EntityArchetype& archetype = archetypes_[kind];
+
+    std::uint32_t slot = firstFreeSlot_;
+    firstFreeSlot_ = slots_[slot].index;
+    slots_[slot].index = static_cast<std::uint32_t>(size());
+
+    slotIndices_.push_back(slot);
+    kinds_.push_back(kind);
+    positions_.push_back(position);
+    previousPositions_.push_back(position);
+    velocities_.push_back(Vector(0.0f, 0.0f));
+    movements_.push_back(Vector(0.0f, 0.0f));
+    hitboxes_.emplace_back((position + archetype.hitboxOffset).getAsVector2f(), archetype.hitboxSize.getAsVector2f());
+    lives_.push_back(archetype.life);
+    damageTimers_.push_back(0.0f);
+    animations_.push_back(archetype.spawnAnimation);
+
+    return { slot, slots_[slot].generation };
+}
+
+/**
+ * @brief Function that removes an entity : the last entity takes its index
+ * @param index         Entity
+ */
+void EntityRegistry::destroy(Index index)
+{
+    // The handles of the entity removed are no longer valid, its slot is reused first
+    std::uint32_t slot = slotIndices_[index];
+    slots_[slot].index = firstFreeSlot_;
+    ++slots_[slot].generation;
+    firstFreeSlot_ = slot;
+
+    Index last = size() - 1;
+    if (index != last)
+    {
+        slotIndices_[index] = slotIndices_[last];
+        kinds_[index] = kinds_[last];
+        positions_[index] = positions_[last];
+        previousPositions_[index] = previousPositions_[last];
+        velocities_[index] = velocities_[last];
+        movements_[index] = movements_[last];
+        hitboxes_[index] = hitboxes_[last];
+        lives_[index] = lives_[last];
+        damageTimers_[index] = damageTimers_[last];
+        animations_[index] = animations_[last];
+
+        slots_[slotIndices_[index]].index = static_cast<std::uint32_t>(index);
+    }
+
+    slotIndices_.pop_back();
+    kinds_.pop_back();
+    positions_.pop_back();
+    previousPositions_.pop_back();
+    velocities_.pop_back();
+    movements_.pop_back();
+    hitboxes_.pop_back();
+    lives_.pop_back();
+    damageTimers_.pop_back();
+    animations_.pop_back();
+}
+
+/**
+ * @brief Function that removes every entity without life (the indices of the others can change)
+ */
+void EntityRegistry::removeDead()
+{
+    Index i = 0;
+    while (i < size())
+    {
+        // The last entity takes the index : checked next
+        if (lives_[i] <= 0)
+            destroy(i);
+        else
+            ++i;
+    }
+}
+
+/**
+ * @brief Function that returns the handle of an entity
+ * @param index         Entity
+ */
+EntityHandle EntityRegistry::getHandle(Index index) const
+{
+    std::uint32_t slot = slotIndices_[index];
+    return { slot, slots_[slot].generation };
+}
+
+/**
+ * @brief Function that returns whether the entity of a handle still exists
+ * @param handle        Handle returned by create or getHandle
+ */
+bool EntityRegistry::isAlive(const EntityHandle& handle) const
+{
+    return handle.slot < slots_.size() && slots_[handle.slot].generation == handle.generation;
+}
+
+/**
+ * @brief Function that returns the current index of an entity (the entity must be alive)
+ * @param handle        Handle returned by create or getHandle
+ */
+EntityRegistry::Index EntityRegistry::getIndex(const EntityHandle& handle) const
+{
+    return slots_[handle.slot].index;
+}
+
+/**
+ * @brief System that makes the entities run towards a position at full speed (except the ones just hit)
+ * @param attractor     Position to run to
+ */
+void EntityRegistry::attract(const Vector& attractor)
+{
+    for (Index i = 0; i < size(); ++i)
+    {
+        if (damageTimers_[i] > 0)
+            continue;
+
+        const EntityArchetype& archetype = archetypes_[kinds_[i]];
+        Vector dp = attractor - positions_[i] - archetype.size * 0.25f;
+        float distance = dp.norm();
+
+        if (distance > 1.0f)
+            velocities_[i] = dp * (archetype.movement.maxSpeed_ / distance);
+        else
+            velocities_[i] = Vector(0.0f, 0.0f);
+    }
+}
+
+/**
+ * @brief System that moves the entities (same rules as MovableEntity::updateMovement)
+ * @param dt            Duration of the step
+ */
+void EntityRegistry::move(const float& dt)
+{
+    for (Index i = 0; i < size(); ++i)
+    {
+        const MovementComponents& movement = archetypes_[kinds_[i]].movement;
+        float maxSpeed = movement.maxSpeed_;
+        float deceleration = movement.movementDeceleration_ * dt;
+
+        float x = std::max(-maxSpeed, std::min(velocities_[i].getX(), maxSpeed));
+        float y = std::max(-maxSpeed, std::min(velocities_[i].getY(), maxSpeed));
+        x = x > 0 ? std::max(x - deceleration, 0.0f) : std::min(x + deceleration, 0.0f);
+        y = y > 0 ? std::max(y - deceleration, 0.0f) : std::min(y + deceleration, 0.0f);
+        velocities_[i] = Vector(x, y);
+
+        previousPositions_[i] = positions_[i];
+        movements_[i] = velocities_[i] * dt;
+        positions_[i] += movements_[i];
+    }
+}
+
+/**
+ * @brief System that counts down the time the entities can't be hit
+ * @param dt            Duration of the step
+ */
+void EntityRegistry::updateDamage(const float& dt)
+{
+    for (float& timer : damageTimers_)
+    {
+        timer = std::max(timer - dt, 0.0f);
+    }
+}
+
+/**
+ * @brief System that advances the animation of every entity
+ * @param dt            Duration of the step
+ */
+void EntityRegistry::animate(const float& dt)
+{
+    for (AnimationState& state : animations_)
+    {
+        AnimationTable::advance(state, dt);
+    }
+}
+
+/**
+ * @brief System that places the hitboxes on the entities
+ */
+void EntityRegistry::updateHitboxes()
+{
+    for (Index i = 0; i < size(); ++i)
+    {
+        const Vector& offset = archetypes_[kinds_[i]].hitboxOffset;
+        hitboxes_[i].left = positions_[i].getX() + offset.getX();
+        hitboxes_[i].top = positions_[i].getY() + offset.getY();
+    }
+}
+
+/**
+ * @brief Function that adds the entities to the terrain collision pass
+ * @param bodies        Bodies of every entity colliding with the terrain
+ */
+void EntityRegistry::addTerrainBodies(std::vector<TerrainBody>& bodies) const
+{
+    for (Index i = 0; i < size(); ++i)
+    {
+        bodies.push_back(TerrainBody { hitboxes_[i], movements_[i], velocities_[i], Vector(0.0f, 0.0f), { false, false, false, false } });
+    }
+}
+
+/**
+ * @brief Function that applies the result of the terrain collision pass
+ * @param bodies        Bodies of the entities (same order as added by addTerrainBodies)
+ */
+void EntityRegistry::applyTerrainCollision(const TerrainBody* bodies)
+{
+    for (Index i = 0; i < size(); ++i)
+    {
+        positions_[i] += bodies[i].offset;
+        velocities_[i] = bodies[i].velocity;
+    }
+
+    updateHitboxes();
+}
+
+/**
+ * @brief Function that adds the entities between the last two steps to the batch of the frame (with their hitbox)
+ * @param target        Where to draw the entities
+ * @param alpha         Time since the last step (fraction of a step)
+ */
+void EntityRegistry::render(std::shared_ptr<RenderSnapshot> target, const float& alpha) const
+{
+    SpriteBatch& batch = target->getBatch();
+    for (Index i = 0; i < size(); ++i)
+    {
+        const EntityArchetype& archetype = archetypes_[kinds_[i]];
+        Vector position = getInterpolatedPosition(i, alpha);
+        bool damaged = damageTimers_[i] > 0;
+
+        sf::IntRect frame = AnimationTable::getTextureRect(animations_[i]);
+        frame.left += archetype.sheet.rect.left;
+        frame.top += archetype.sheet.rect.top;
+        batch.draw(archetype.sheet.texture.get(), frame, position.getAsVector2f(), damaged ? sf::Color::Red : sf::Color::White);
+
+        batch.drawOutline(sf::FloatRect((position + archetype.hitboxOffset).getAsVector2f(), archetype.hitboxSize.getAsVector2f()),
+            damaged ? sf::Color::Yellow : sf::Color::Red);
+    }
+}
+
+/**
+ * @brief Function that returns the position of an entity between the last two steps
+ * @param index         Entity
+ * @param alpha         Time since the last step (fraction of a step)
+ */
+Vector EntityRegistry::getInterpolatedPosition(Index index, const float& alpha) const
+{
+    return previousPositions_[index] + (positions_[index] - previousPositions_[index]) * alpha;
+}
+
+/**
+ * @brief Function that damages an entity (it can't be hit again for DAMAGE_DURATION)
+ * @param index         Entity
+ * @param value         Life removed
+ */
+void EntityRegistry::damage(Index index, float value)
+{
+    lives_[index] -= value;
+    damageTimers_[index] = DAMAGE_DURATION;
+}
+
+/**
+ * @brief Function that moves an entity without interpolation (pushed by another entity)
+ * @param index         Entity
+ * @param offset        Movement
+ */
+void EntityRegistry::translate(Index index, const Vector& offset)
+{
+    positions_[index] += offset;
+    previousPositions_[index] += offset;
+}
+
+/**
+ * @brief Function that returns the number of entities
+ */
+std::size_t EntityRegistry::size() const
+{
+    return positions_.size();
+}
+
+/**
+ * @brief Function that returns the maximum number of entities
+ */
+std::size_t EntityRegistry::capacity() const
+{
+    return capacity_;
+}
+
+/**
+ * @brief Function that returns whether no entity can be created
+ */
+bool EntityRegistry::isFull() const
+{
+    return firstFreeSlot_ == NO_SLOT;
+}
+
+/**
+ * @brief Function that returns the values shared by the entities of a kind
+ * @param kind          Kind
+ */
+EntityArchetype& EntityRegistry::getArchetype(Kind kind)
+{
+    return archetypes_[kind];
+}
+
+/**
+ * @brief Function that returns the values shared by the entities of a kind
+ * @param kind          Kind
+ */
+const EntityArchetype& EntityRegistry::getArchetype(Kind kind) const
+{
+    return archetypes_[kind];
+}
+
+/**
+ * @brief Function that returns the kind of an entity
+ * @param index         Entity
+ */
+EntityRegistry::Kind EntityRegistry::getKind(Index index) const
+{
+    return kinds_[index];
+}
+
+/**
+ * @brief Function that returns the position of an entity
+ * @param index         Entity
+ */
+const Vector& EntityRegistry::getPosition(Index index) const
+{
+    return positions_[index];
+}
+
+/**
+ * @brief Function that returns the velocity of an entity
+ * @param index         Entity
+ */
+const Vector& EntityRegistry::getVelocity(Index index) const
+{
+    return velocities_[index];
+}
+
+/**
+ * @brief Function that returns the hitbox of an entity
+ * @param index         Entity
+ */
+const sf::FloatRect& EntityRegistry::getHitbox(Index index) const
+{
+    return hitboxes_[index];
+}
+
+/**
+ * @brief Function that returns the hitboxes of every entity (same order as the entities)
+ */
+const std::vector<sf::FloatRect>& EntityRegistry::getHitboxes() const
+{
+    return hitboxes_;
+}
+
+/**
+ * @brief Function that returns the life of an entity
+ * @param index         Entity
+ */
+float EntityRegistry::getLife(Index index) const
+{
+    return lives_[index];
+}
+
+/**
+ * @brief Function that returns whether an entity was hit recently
+ * @param index         Entity
+ */
+bool EntityRegistry::isDamaged(Index index) const
+{
+    return damageTimers_[index] > 0;
+}
+
+/**
+ * @brief Function that changes the velocity of an entity
+ * @param index         Entity
+ * @param velocity      Velocity
+ */
+void EntityRegistry::setVelocity(Index index, const Vector& velocity)
+{
+    velocities_[index] = velocity;
+}
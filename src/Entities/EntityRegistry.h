@@ -0,0 +1,119 @@
+#ifndef ENTITY_REGISTRY_H
+#define ENTITY_REGISTRY_H
+
+#include "MovableEntity.h"
+#include "../Map/TerrainBody.h"
+
+// Values shared by every entity of a kind
+struct EntityArchetype
+{
+    Vector size;
+    Vector hitboxOffset;
+    Vector hitboxSize;
+    MovementComponents movement;
+    float life;
+    float experience;           // Given to the player when hit
+    ClipID clip;                // Clip played (@see AnimationTable)
+    TextureRegion sheet;        // Sprite sheet of the clip (in an atlas)
+    AnimationState spawnAnimation = { 0, 0, 0.0f };     // Copied to the entities created (set by addArchetype)
+};
+
+// Handle on an entity that stays valid while the entity exists (its index changes when others are removed)
+// The generation tells apart the entities that used the same slot
+struct EntityHandle
+{
+    std::uint32_t slot;
+    std::uint32_t generation;
+};
+
+// Storage of the enemies as a struct of arrays : one array per component, the same index for every array
+// Systems (attraction, movement, damage, animation, hitboxes, terrain collision) iterate the arrays linearly,
+// without any virtual call or allocation per entity
+// The arrays are reserved for a fixed number of entities : creating and removing entities never allocates
+class EntityRegistry
+{
+public:
+
+    typedef std::size_t Index;
+    typedef std::uint16_t Kind;
+
+    static constexpr float DAMAGE_DURATION = 2.0f;      // Time an entity can't be hit again (in seconds)
+    static constexpr std::size_t DEFAULT_CAPACITY = 1024;
+
+    EntityRegistry(std::size_t capacity = DEFAULT_CAPACITY);
+    virtual ~EntityRegistry();
+
+    Kind addArchetype(const EntityArchetype& archetype);
+    EntityHandle create(Kind kind, const Vector& position);
+    void destroy(Index index);
+    void removeDead();
+
+    // Handles
+    EntityHandle getHandle(Index index) const;
+    bool isAlive(const EntityHandle& handle) const;
+    Index getIndex(const EntityHandle& handle) const;
+
+    // Systems
+    void attract(const Vector& attractor);
+    void move(const float& dt);
+    void updateDamage(const float& dt);
+    void animate(const float& dt);
+    void updateHitboxes();
+    void addTerrainBodies(std::vector<TerrainBody>& bodies) const;
+    void applyTerrainCollision(const TerrainBody* bodies);
+    void render(std::shared_ptr<RenderSnapshot> target, const float& alpha) const;
+
+    // Components of an entity
+    Vector getInterpolatedPosition(Index index, const float& alpha) const;
+    void damage(Index index, float value);
+    void translate(Index index, const Vector& offset);
+
+    // Getters
+    std::size_t size() const;
+    std::size_t capacity() const;
+    bool isFull() const;
+    EntityArchetype& getArchetype(Kind kind);
+    const EntityArchetype& getArchetype(Kind kind) const;
+    Kind getKind(Index index) const;
+    const Vector& getPosition(Index index) const;
+    const Vector& getVelocity(Index index) const;
+    const sf::FloatRect& getHitbox(Index index) const;
+    const std::vector<sf::FloatRect>& getHitboxes() const;
+    float getLife(Index index) const;
+    bool isDamaged(Index index) const;
+
+    // Setters
+    void setVelocity(Index index, const Vector& velocity);
+
+private:
+
+    // Slot of a handle : index of the entity when used, next free slot otherwise
+    struct Slot
+    {
+        std::uint32_t index;
+        std::uint32_t generation;
+    };
+
+    static constexpr std::uint32_t NO_SLOT = std::numeric_limits<std::uint32_t>::max();
+
+    std::vector<EntityArchetype> archetypes_;
+    const std::size_t capacity_;
+
+    // Handles (one slot per entity of the capacity, free slots linked together)
+    std::vector<Slot> slots_;
+    std::uint32_t firstFreeSlot_;
+
+    // Components (one element per entity)
+    std::vector<std::uint32_t> slotIndices_;    // Slot of the handle of the entity
+    std::vector<Kind> kinds_;
+    std::vector<Vector> positions_;
+    std::vector<Vector> previousPositions_;     // Before the last step (rendering between two steps)
+    std::vector<Vector> velocities_;
+    std::vector<Vector> movements_;             // Movement of the last step (swept against the terrain)
+    std::vector<sf::FloatRect> hitboxes_;
+    std::vector<float> lives_;
+    std::vector<float> damageTimers_;           // Time left before the entity can be hit again
+    std::vector<AnimationState> animations_;
+};
+
+#endif
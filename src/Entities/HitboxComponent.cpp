@@ -37,12 +37,12 @@ void HitboxComponent::update(const float& dt)
 }
 
 /**
- * @brief Method that renders the hitbox component
+ * @brief Method that renders the outline of the hitbox (only while the batch draws debug outlines)
  * @param window    Target where the draw the hitbox
  */
-void HitboxComponent::render(std::shared_ptr<sf::RenderTarget> target)
+void HitboxComponent::render(std::shared_ptr<RenderSnapshot> target)
 {
-    target->draw(*this);
+    target->getBatch().drawOutline(getHitbox(), getOutlineColor());
 }
 
 /**
@@ -12,7 +12,7 @@ public:
     virtual ~HitboxComponent();
 
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target);
+    virtual void render(std::shared_ptr<RenderSnapshot> target);
     bool isIntersecting(const sf::FloatRect& rect) const;
 
     sf::FloatRect getHitbox() const; 
@@ -14,6 +14,7 @@ MovableEntity::MovableEntity(Vector position, Vector size, MovementComponents mo
     ,   movementComponents_(movementComponents)
     ,   velocity_(0, 0)
     ,   acceleration_(0, 0)
+    ,   movement_(0, 0)
     ,   availableDirections({true, true, true, true})
     ,   damaged_(false)
     ,   life_(life)
@@ -31,11 +32,16 @@ MovableEntity::~MovableEntity()
  */
 void MovableEntity::updateMovement(const float& dt)
 {   
-    // Updating variables
+    previousPosition_ = position_;
+
+    // Updating variables (the acceleration of the inputs since the last update)
+    velocity_ += acceleration_ * dt;
+    acceleration_ = Vector(0.0f, 0.0f);
     validateMaxSpeed(velocity_);
-    applyDeceleration(velocity_);
+    applyDeceleration(velocity_, dt);
     
-    position_ += velocity_ * dt;
+    movement_ = velocity_ * dt;
+    position_ += movement_;
     center_ = position_ + size_ * 0.5f;
 
     // Updating objects on screen
@@ -46,6 +52,7 @@ void MovableEntity::updateMovement(const float& dt)
 
 /**
  * @brief Method that moves the entity in a certain diretion according to it's movement speed
+ * The acceleration is applied by the next update (per second)
  * @param dx            Movement in the x direction
  * @param dy            Movement in the y direction
  */
@@ -53,8 +60,7 @@ void MovableEntity::move(const float& dx, const float& dy)
 {
     Vector movement(dx, dy);
 
-    acceleration_ = Vector(dx, dy) * movementComponents_.movementAcceleration_;
-    velocity_ += acceleration_;
+    acceleration_ += Vector(dx, dy) * movementComponents_.movementAcceleration_;
 
     updateDirection(movement);
 
@@ -85,49 +91,98 @@ void MovableEntity::validateMaxSpeed(Vector& velocity)
 }
 
 /**
- * @brief Method that applies a deceleration on the velocity given
+ * @brief Method that applies a deceleration on the velocity given (per second)
  * @param velocity  velocity
+ * @param dt        Time of the step
  */
-void MovableEntity::applyDeceleration(Vector& velocity)
+void MovableEntity::applyDeceleration(Vector& velocity, const float& dt)
 {
+    float deceleration = movementComponents_.movementDeceleration_ * dt;
+
     if (velocity.getX() > 0)
+        velocity.setX(std::max(velocity.getX() - deceleration, 0.0f));
+    else if (velocity.getX() < 0)
+        velocity.setX(std::min(velocity.getX() + deceleration, 0.0f));
+
+    if (velocity.getY() > 0)
+        velocity.setY(std::max(velocity.getY() - deceleration, 0.0f));
+    else if (velocity.getY() < 0)
+        velocity.setY(std::min(velocity.getY() + deceleration, 0.0f));
+}
+
+/**
+ * @brief Function that updates the damage value
+ */
+void MovableEntity::updateDamage() 
+{
+
+    if (damaged_ && damageClock_.getElapsedTime().asSeconds() > 2.0f)
     {
-        velocity += Vector(-movementComponents_.movementDeceleration_, 0.0f);
-        if (velocity_.getX() < 0)
-            velocity_.setX(0);
+        damageClock_.restart();
+        damaged_ = false;
     }
-    else if (velocity_.getX() < 0)
+}
+
+/**
+ * @brief Function that applies a force on the entity
+ * @param force         Force (only the direction is taken into account)
+ */
+void MovableEntity::applyForce(const Vector& force)
+{
+    if (force.getX() > 0)
     {
-        velocity += Vector(movementComponents_.movementDeceleration_, 0.0f);
-        if (velocity_.getX() > 0)
-            velocity_.setX(0);
-    }
-    
-    if (velocity.getY() > 0)
+        availableDirections[LEFT] = false;
+    } else if (force.getX() < 0)
     {
-        velocity += Vector(0.0f, -movementComponents_.movementDeceleration_);
-        if (velocity_.getY() < 0)
-            velocity_.setY(0);
+        availableDirections[RIGHT] = false;
     }
-    else if (velocity_.getY() < 0)
+
+    if (force.getY() > 0)
+    {
+        availableDirections[UP] = false;
+    } else if (force.getY() < 0)
     {
-        velocity += Vector(0.0f, movementComponents_.movementDeceleration_ );
-        if (velocity_.getY() > 0)
-            velocity_.setY(0);
+        availableDirections[DOWN] = false;
     }
+
+    position_ += force;
+
+    if (force.getX() != 0)
+        velocity_.setX(0);
+
+    if (force.getY() != 0)
+        velocity_.setY(0);
 }
 
 /**
- * @brief Function that updates the damage value
+ * @brief Function that returns the entity as seen by the terrain collision pass
  */
-void MovableEntity::updateDamage() 
+TerrainBody MovableEntity::getTerrainBody() const
 {
+    return TerrainBody { getHitbox().getHitbox(), movement_, velocity_, Vector(0.0f, 0.0f), { false, false, false, false } };
+}
 
-    if (damaged_ && damageClock_.getElapsedTime().asSeconds() > 2.0f)
+/**
+ * @brief Function that applies the result of the terrain collision pass
+ * @param body          Body returned by the pass (see getTerrainBody)
+ */
+void MovableEntity::applyTerrainCollision(const TerrainBody& body)
+{
+    for (int direction = LEFT; direction <= DOWN; ++direction)
     {
-        damageClock_.restart();
-        damaged_ = false;
+        if (body.blocked[direction])
+            availableDirections[direction] = false;
     }
+
+    position_ += body.offset;
+    velocity_ = body.velocity;
+
+    // The collisions checked after this pass see the corrected position
+    center_ = position_ + size_ * 0.5f;
+    rect_.setPosition(position_.getAsVector2f());
+    sprite_.setPosition(position_.getAsVector2f());
+    if (hitboxComponent_)
+        hitboxComponent_->update(0.0f);
 }
 
 /**
@@ -2,7 +2,9 @@
 #define MOVABLE_ENTITY_H
 
 #include "Entity.h"
+#include "../Map/TerrainBody.h"
 
+// Speed in pixels per second, acceleration and deceleration in pixels per second squared
 struct MovementComponents
 {
     MovementComponents(float speed, float acceleration, float deceleration)
@@ -35,8 +37,11 @@ public:
     virtual void move(const float& dx, const float& dy);
     
     virtual void validateMaxSpeed(Vector& velocity);
-    virtual void applyDeceleration(Vector& velocity);
+    virtual void applyDeceleration(Vector& velocity, const float& dt);
     virtual void updateDamage();
+    virtual void applyForce(const Vector& force);
+    virtual TerrainBody getTerrainBody() const;
+    virtual void applyTerrainCollision(const TerrainBody& body);
 
     // Getters
     virtual float getMaxSpeed() const 
@@ -97,6 +102,7 @@ protected:
 
     Vector velocity_;
     Vector acceleration_;
+    Vector movement_;           // Movement of the last update (swept against the terrain)
     Vector forceApplied_;
 
     bool availableDirections[4];
@@ -51,50 +51,81 @@ void Player::update(const float& dt)
     sword_.update(dt);
 }
 
+/**
+ * @brief Function that applies the result of the terrain collision pass (the sword follows the player)
+ * @param body          Body returned by the pass (see getTerrainBody)
+ */
+void Player::applyTerrainCollision(const TerrainBody& body)
+{
+    MovableEntity::applyTerrainCollision(body);
+    sword_.updatePosition();
+}
+
+/**
+ * @brief Function that places the player between the last two simulation steps, the sword follows the drawn sprite
+ * @param alpha         Time since the last step (fraction of a step)
+ */
+void Player::interpolate(const float& alpha)
+{
+    MovableEntity::interpolate(alpha);
+    sword_.updatePosition();
+}
+
+/**
+ * @brief Function that places the player and the sword back at the simulated position (before the next step)
+ */
+void Player::restorePosition()
+{
+    MovableEntity::restorePosition();
+    sword_.updatePosition();
+}
+
 /**
  * @brief Function that draws the player on the window
  * @param window    Window where the player will be drawn into
  */
-void Player::render(std::shared_ptr<sf::RenderTarget> target)
+void Player::render(std::shared_ptr<RenderSnapshot> target)
 {
     Direction direction = getDirection();
     if (direction == DOWN || direction == RIGHT || direction == NOT_MOVING)
     {
-        target->draw(sprite_);
+        target->getBatch().draw(sprite_);
         sword_.render(target);
     } else
     {
         sword_.render(target);
-        target->draw(sprite_);
+        target->getBatch().draw(sprite_);
     }
 
-    //hitboxComponent_->render(target);
+    hitboxComponent_->render(target);
 
 }
 
 /**
- * @brief Function that adds a texture to the player (with the animations)
- * @param texture   Texture
+ * @brief Function that adds a sprite sheet to the player (with the animations)
+ * @param sheet     Sprite sheet
  */
-void Player::addTexture(std::shared_ptr<sf::Texture> texture_)
+void Player::addTexture(const TextureRegion& sheet)
 {
     // Adding the texture to the sprite
-    Entity::addTexture(texture_);
+    Entity::addTexture(sheet);
 
-    createAnimationComponent(*texture_);
-    
-    // Adding the animations (walk, stand, ...)
+    // Finding the animations (walk, stand, ...)
     initializeAnimations();
 
+    createAnimationComponent(clips_[NOT_MOVING]);
+
 }
 
 /**
- * @brief Function that adds a texture to the sword
- * @param texture   Texture
+ * @brief Function that adds the sprite sheets to the sword
+ * @param sheet         Sprite sheet of the sword
+ * @param attackSheet   Sprite sheet of the swoosh
  */
-void Player::addSwordTexture(std::shared_ptr<sf::Texture> texture_)
+void Player::addSwordTexture(const TextureRegion& sheet, const TextureRegion& attackSheet)
 {
-    sword_.addTexture(texture_);
+    sword_.addTexture(sheet);
+    sword_.addAttackTexture(attackSheet);
     sword_.initializeAnimations(attackSpeed_);
 }
 
@@ -117,81 +148,15 @@ void Player::handleMouseEvents(const Vector& mousePosition)
 }
 
 /**
- * @brief Function that applies a force on the entity
- * @param force         Force (only the direction is taken into account)
- */
-void Player::applyForce(const Vector& force)
-{
-    if (force.getX() > 0)
-    {
-        availableDirections[LEFT] = false;
-    } else if (force.getX() < 0)
-    {
-        availableDirections[RIGHT] = false;
-    }
-
-    if (force.getY() > 0)
-    {
-        availableDirections[UP] = false;
-    } else if (force.getY() < 0)
-    {
-        availableDirections[DOWN] = false;
-    }
-
-    position_ += force;
-
-    if (force.getX() != 0)
-        velocity_.setX(0);
-
-    if (force.getY() != 0)
-        velocity_.setY(0);
-}
-
-
-/**
- * @brief Method that generates every animation needed the player
+ * @brief Method that finds every animation needed by the player in the animation table
  */
 void Player::initializeAnimations()
 {
-    animationComponent_->addAnimation(
-        "MOVE_LEFT",            // Animation name
-        10.0f,                  // Animation speed
-        sf::Vector2i(0, 9),     // First of frame's position on texture sheet
-        sf::Vector2i(8, 0),     // Number of frames to parcour
-        sf::Vector2i(64, 64)
-    );
-
-    animationComponent_->addAnimation(
-        "MOVE_RIGHT",           // Animation name
-        10.0f,                  // Animation speed
-        sf::Vector2i(0, 11),    // First of frame's position on texture sheet
-        sf::Vector2i(8, 0),    // Number of frames to parcour
-        sf::Vector2i(64, 64)
-    );
-
-    animationComponent_->addAnimation(
-        "MOVE_UP",              // Animation name
-        10.0f,                  // Animation speed
-        sf::Vector2i(0, 8),     // First of frame's position on texture sheet
-        sf::Vector2i(8, 0),     // Number of frames to parcour
-        sf::Vector2i(64, 64)
-    );
-
-    animationComponent_->addAnimation(
-        "MOVE_DOWN",            // Animation name
-        10.0f,                  // Animation speed
-        sf::Vector2i(0, 10),    // First of frame's position on texture sheet
-        sf::Vector2i(8, 0),     // Number of frames to parcour
-        sf::Vector2i(64, 64)
-    );
-
-    animationComponent_->addAnimation(
-        "IDLE",
-        10.0f,
-        sf::Vector2i(0, 10),
-        sf::Vector2i(0, 0),
-        sf::Vector2i(64, 64)
-    );
+    clips_[LEFT] = AnimationTable::getID("player_move_left");
+    clips_[RIGHT] = AnimationTable::getID("player_move_right");
+    clips_[UP] = AnimationTable::getID("player_move_up");
+    clips_[DOWN] = AnimationTable::getID("player_move_down");
+    clips_[NOT_MOVING] = AnimationTable::getID("player_idle");
 }
 
 /**
@@ -205,19 +170,15 @@ void Player::updateAnimations(const float& dt)
     switch (direction)
     {
         case LEFT:
-            animationComponent_->playAnimation("MOVE_LEFT", dt, velocity_.getX(), movementComponents_.maxSpeed_);
-            break;
         case RIGHT:
-            animationComponent_->playAnimation("MOVE_RIGHT", dt, velocity_.getX(), movementComponents_.maxSpeed_);
+            animationComponent_->playAnimation(clips_[direction], dt, velocity_.getX(), movementComponents_.maxSpeed_);
             break;
         case UP:
-            animationComponent_->playAnimation("MOVE_UP", dt, velocity_.getY(), movementComponents_.maxSpeed_);
-            break;
         case DOWN:
-            animationComponent_->playAnimation("MOVE_DOWN", dt, velocity_.getY(), movementComponents_.maxSpeed_);
+            animationComponent_->playAnimation(clips_[direction], dt, velocity_.getY(), movementComponents_.maxSpeed_);
             break;
         default:
-            animationComponent_->playAnimation("IDLE", dt);
+            animationComponent_->playAnimation(clips_[NOT_MOVING], dt);
             break;
     }
 
@@ -15,11 +15,13 @@ public:
     virtual ~Player();
 
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target);
-    virtual void addTexture(std::shared_ptr<sf::Texture> texture_);
-    virtual void addSwordTexture(std::shared_ptr<sf::Texture> texture_);
+    virtual void render(std::shared_ptr<RenderSnapshot> target);
+    virtual void addTexture(const TextureRegion& sheet);
+    virtual void addSwordTexture(const TextureRegion& sheet, const TextureRegion& attackSheet);
     virtual void handleMouseEvents(const Vector& mousPosition);
-    virtual void applyForce(const Vector& force);
+    virtual void applyTerrainCollision(const TerrainBody& body);
+    virtual void interpolate(const float& alpha);
+    virtual void restorePosition();
     virtual void addExperienceBar(HUD::ExperienceBar* experienceBar);
 
     // Getters
@@ -49,6 +51,9 @@ private:
     sf::Clock damageClock_;
     float attackSpeed_ = 0.5f;
 
+    // Clip played in each direction (NOT_MOVING : idle)
+    std::array<ClipID, NOT_MOVING + 1> clips_;
+
     HUD::ExperienceBar* experienceBar_;
 };
 
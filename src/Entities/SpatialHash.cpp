@@ -0,0 +1,187 @@
+#include "../headers.h"
+#include "SpatialHash.h"
+
+/**
+ * @brief Constructor
+ * @param cellSize      Size of a cell (around the size of the biggest hitbox)
+ */
+SpatialHash::SpatialHash(float cellSize)
+    :   cellSize_(cellSize)
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+SpatialHash::~SpatialHash()
+{
+
+}
+
+/**
+ * @brief Function that removes every rectangle (the memory is kept for the next frame)
+ */
+void SpatialHash::clear()
+{
+    rects_.clear();
+    entries_.clear();
+}
+
+/**
+ * @brief Function that registers a rectangle in every cell it covers
+ * @param rect      Rectangle
+ * @return          ID of the rectangle
+ */
+SpatialHash::ID SpatialHash::insert(const sf::FloatRect& rect)
+{
+    ID id = static_cast<ID>(rects_.size());
+    rects_.push_back(rect);
+
+    int lastX = getCell(rect.left + rect.width);
+    int lastY = getCell(rect.top + rect.height);
+    for (int y = getCell(rect.top); y <= lastY; ++y)
+    {
+        for (int x = getCell(rect.left); x <= lastX; ++x)
+        {
+            entries_.push_back({ getKey(x, y), id });
+        }
+    }
+
+    return id;
+}
+
+/**
+ * @brief Function that registers a hitbox
+ * @param hitbox    Hitbox
+ * @return          ID of the hitbox
+ */
+SpatialHash::ID SpatialHash::insert(const HitboxComponent& hitbox)
+{
+    return insert(hitbox.getHitbox());
+}
+
+/**
+ * @brief Function that groups the rectangles by cell (to call after the insertions, before any query)
+ */
+void SpatialHash::build()
+{
+    std::sort(entries_.begin(), entries_.end(), [](const Entry& a, const Entry& b)
+    {
+        return a.cell < b.cell || (a.cell == b.cell && a.id < b.id);
+    });
+}
+
+/**
+ * @brief Function that returns the rectangles intersecting an area (each one once, in no particular order)
+ * @param area      Area
+ * @param out       IDs of the rectangles (cleared first)
+ */
+void SpatialHash::query(const sf::FloatRect& area, std::vector<ID>& out) const
+{
+    out.clear();
+
+    int firstX = getCell(area.left);
+    int firstY = getCell(area.top);
+    int lastX = getCell(area.left + area.width);
+    int lastY = getCell(area.top + area.height);
+
+    for (int y = firstY; y <= lastY; ++y)
+    {
+        for (int x = firstX; x <= lastX; ++x)
+        {
+            std::uint64_t key = getKey(x, y);
+            auto it = std::lower_bound(entries_.begin(), entries_.end(), key, [](const Entry& entry, std::uint64_t cell)
+            {
+                return entry.cell < cell;
+            });
+
+            for (; it != entries_.end() && it->cell == key; ++it)
+            {
+                const sf::FloatRect& rect = rects_[it->id];
+                if (!rect.intersects(area))
+                    continue;
+
+                // Reported only in the first cell shared by the area and the rectangle
+                if (x == std::max(firstX, getCell(rect.left)) && y == std::max(firstY, getCell(rect.top)))
+                    out.push_back(it->id);
+            }
+        }
+    }
+}
+
+/**
+ * @brief Function that returns every pair of intersecting rectangles (each pair once)
+ * @param pairs     Pairs found (cleared first), sorted by cell
+ */
+void SpatialHash::findPairs(std::vector<Pair>& pairs) const
+{
+    pairs.clear();
+
+    for (std::size_t begin = 0; begin < entries_.size();)
+    {
+        std::size_t end = begin + 1;
+        while (end < entries_.size() && entries_[end].cell == entries_[begin].cell)
+            ++end;
+
+        for (std::size_t i = begin; i < end; ++i)
+        {
+            for (std::size_t j = i + 1; j < end; ++j)
+            {
+                sf::FloatRect overlap;
+                if (!rects_[entries_[i].id].intersects(rects_[entries_[j].id], overlap))
+                    continue;
+
+                // Reported only in the cell holding the top left corner of the overlap
+                if (getKey(getCell(overlap.left), getCell(overlap.top)) == entries_[begin].cell)
+                    pairs.emplace_back(entries_[i].id, entries_[j].id);
+            }
+        }
+
+        begin = end;
+    }
+}
+
+/**
+ * @brief Function that returns the number of rectangles registered
+ */
+std::size_t SpatialHash::size() const
+{
+    return rects_.size();
+}
+
+/**
+ * @brief Function that returns a rectangle registered
+ * @param id        ID returned by insert
+ */
+const sf::FloatRect& SpatialHash::getRect(ID id) const
+{
+    return rects_[id];
+}
+
+/**
+ * @brief Function that returns the size of a cell
+ */
+float SpatialHash::getCellSize() const
+{
+    return cellSize_;
+}
+
+/**
+ * @brief Function that returns the key of a cell
+ * @param x         X coordinate of the cell
+ * @param y         Y coordinate of the cell
+ */
+std::uint64_t SpatialHash::getKey(int x, int y)
+{
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+}
+
+/**
+ * @brief Function that returns the cell of a coordinate (on one axis)
+ * @param coordinate    Coordinate in the world
+ */
+int SpatialHash::getCell(float coordinate) const
+{
+    return static_cast<int>(std::floor(coordinate / cellSize_));
+}
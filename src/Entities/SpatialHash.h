@@ -0,0 +1,51 @@
+#ifndef SPATIAL_HASH_H
+#define SPATIAL_HASH_H
+
+#include "HitboxComponent.h"
+
+// Broad phase of the entity collisions : uniform grid rebuilt every frame
+// Hitboxes are registered in every cell they cover, then sorted by cell so that each cell is a contiguous run
+// The candidates returned are only intersecting bounding boxes, the narrow phase decides what happens
+class SpatialHash
+{
+public:
+
+    typedef std::uint32_t ID;                   // Order of insertion since the last clear
+    typedef std::pair<ID, ID> Pair;             // First ID is always the smallest
+
+    static constexpr float DEFAULT_CELL_SIZE = 128.0f;
+
+    SpatialHash(float cellSize = DEFAULT_CELL_SIZE);
+    virtual ~SpatialHash();
+
+    void clear();
+    ID insert(const sf::FloatRect& rect);
+    ID insert(const HitboxComponent& hitbox);
+    void build();
+
+    void query(const sf::FloatRect& area, std::vector<ID>& out) const;
+    void findPairs(std::vector<Pair>& pairs) const;
+
+    // Getters
+    std::size_t size() const;
+    const sf::FloatRect& getRect(ID id) const;
+    float getCellSize() const;
+
+private:
+
+    // Rectangle registered in a cell
+    struct Entry
+    {
+        std::uint64_t cell;
+        ID id;
+    };
+
+    static std::uint64_t getKey(int x, int y);
+    int getCell(float coordinate) const;
+
+    float cellSize_;
+    std::vector<sf::FloatRect> rects_;
+    std::vector<Entry> entries_;               // Sorted by cell then by ID once built
+};
+
+#endif
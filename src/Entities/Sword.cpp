@@ -49,6 +49,15 @@ Sword::~Sword()
  * @param dt        Time since last frame
  */
 void Sword::update(const float& dt)
+{
+    updatePosition();
+    updateAnimations(dt);
+}
+
+/**
+ * @brief Function that places the sword and its hitbox next to the player's sprite
+ */
+void Sword::updatePosition()
 {
     position_ = ((Vector(playerSprite_.getPosition()) + offsets_.at(currentDirection_)).getAsVector2f());
     center_ = position_ + (size_ * 0.5f);
@@ -57,41 +66,43 @@ void Sword::update(const float& dt)
     hitboxComponent_->setPosition(position_.getAsVector2f());
 
     attackSprite_.setPosition(attackHitbox_->getPosition());
-
-    updateAnimations(dt);
 }
 
 /**
  * @brief Function that draws the player on the window
  * @param window    Window where the player will be drawn into
  */
-void Sword::render(std::shared_ptr<sf::RenderTarget> target)
+void Sword::render(std::shared_ptr<RenderSnapshot> target)
 {
-    target->draw(sprite_);
-    target->draw(attackSprite_);
+    // Same depth as the player : drawn before or after the player depending on the order of the calls
+    sf::FloatRect playerBounds = playerSprite_.getGlobalBounds();
+    target->getBatch().draw(sprite_, SpriteBatch::ENTITIES, playerBounds.top + playerBounds.height);
+    target->getBatch().draw(attackSprite_, SpriteBatch::EFFECTS);
     // hitboxComponent_->render(target);
     
-    // if (hitboxActivated_)
-       // attackHitbox_->render(target);
+    if (hitboxActivated_)
+        attackHitbox_->render(target);
 
 }
 
 /**
- * @brief Function that adds a texture to the player (with the animations)
- * @param texture   Texture
+ * @brief Function that adds a sprite sheet to the sword (with the animations)
+ * @param sheet     Sprite sheet
  */
-void Sword::addTexture(std::shared_ptr<sf::Texture> texture_)
+void Sword::addTexture(const TextureRegion& sheet)
 {
-    Entity::addTexture(texture_);
-
-    createAnimationComponent(*texture_);
+    Entity::addTexture(sheet);
 
-    // Adding swoosh animation
-    if (!attackTexture_.loadFromFile("resources/game/player/attack_sprite_sheet.png"))
-        throw("Attack texture not loaded");
-
-    attackAnimation_ = std::make_unique<AnimationComponent>(attackSprite_, attackTexture_);
+    createAnimationComponent(AnimationTable::getID("sword_idle"));
+}
 
+/**
+ * @brief Function that adds the sprite sheet of the swoosh drawn when attacking (with its animations)
+ * @param sheet     Sprite sheet
+ */
+void Sword::addAttackTexture(const TextureRegion& sheet)
+{
+    attackAnimation_ = std::make_unique<AnimationComponent>(attackSprite_, sheet, AnimationTable::getID("swoosh_idle"));
 }
 
 /**
@@ -157,41 +168,16 @@ void Sword::handleMouseEvents(const Vector& mousePosition)
 }
 
 /**
- * @brief Method that generates every animation needed the player
+ * @brief Method that finds every animation needed by the sword in the animation table
+ * @param attackSpeed   Duration of an attack (the attack clips are played in this time)
  */
 void Sword::initializeAnimations(float attackSpeed)
 {
-    animationComponent_->addAnimation(
-        "ATTACK",                   // Animation name
-        10.0f * attackSpeed,                     // Animation speed
-        sf::Vector2i(0, 0),         // First of frame's position on texture sheet
-        sf::Vector2i(4, 0),         // Number of frames to parcour
-        sf::Vector2i(32, 32)        // size
-    );
-
-    animationComponent_->addAnimation(
-        "IDLE",               // Animation name
-        10.0f,                  // Animation speed
-        sf::Vector2i(0, 0),     // First of frame's position on texture sheet
-        sf::Vector2i(0, 0),     // Number of frames to parcour
-        sf::Vector2i(32, 32)    // size
-    );
-
-    attackAnimation_->addAnimation(
-        "ATTACK",
-        10.0f * attackSpeed,
-        sf::Vector2i(1, 0),         // First of frame's position on texture sheet
-        sf::Vector2i(5, 0),         // Number of frames to parcour
-        sf::Vector2i(32, 32) 
-    );
-
-    attackAnimation_->addAnimation(
-        "IDLE",
-        10.0f,
-        sf::Vector2i(0, 0),         // First of frame's position on texture sheet
-        sf::Vector2i(0, 0),         // Number of frames to parcour
-        sf::Vector2i(32, 32) 
-    );
+    attackClip_ = AnimationTable::getID("sword_attack");
+    idleClip_ = AnimationTable::getID("sword_idle");
+    swooshAttackClip_ = AnimationTable::getID("swoosh_attack");
+    swooshIdleClip_ = AnimationTable::getID("swoosh_idle");
+    attackAnimationSpeed_ = 1.0f / attackSpeed;
 }
 
 /**
@@ -202,13 +188,13 @@ void Sword::updateAnimations(const float& dt)
 {
     if (hitboxActivated_)
     {
-        animationComponent_->playAnimation("ATTACK", dt);
-        attackAnimation_->playAnimation("ATTACK", dt);
+        animationComponent_->playAnimation(attackClip_, dt, attackAnimationSpeed_);
+        attackAnimation_->playAnimation(swooshAttackClip_, dt, attackAnimationSpeed_);
     }
     else
     {
-        animationComponent_->playAnimation("IDLE", dt);
-        attackAnimation_->playAnimation("IDLE", dt);
+        animationComponent_->playAnimation(idleClip_, dt);
+        attackAnimation_->playAnimation(swooshIdleClip_, dt);
     }
     
 
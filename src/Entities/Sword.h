@@ -16,8 +16,10 @@ public:
     virtual ~Sword();
 
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target);
-    virtual void addTexture(std::shared_ptr<sf::Texture> texture_);
+    virtual void updatePosition();
+    virtual void render(std::shared_ptr<RenderSnapshot> target);
+    virtual void addTexture(const TextureRegion& sheet);
+    virtual void addAttackTexture(const TextureRegion& sheet);
     virtual void handleMouseEvents(const Vector& mousePosition);
     virtual void initializeAnimations(float attackSpeed);
     virtual void updateAnimations(const float& dt);
@@ -28,6 +30,9 @@ public:
     virtual bool isIntersecting(const HitboxComponent& rect) const
         { return attackHitbox_->isIntersecting(rect.getHitbox()); };
 
+    virtual bool isIntersecting(const sf::FloatRect& rect) const
+        { return attackHitbox_->isIntersecting(rect); };
+
     virtual const HitboxComponent& getHitbox() const
         { return *attackHitbox_; }; 
 
@@ -48,10 +53,16 @@ private:
     bool hitboxActivated_;
     float attackDamage_;
 
-    sf::Texture attackTexture_;
     sf::Sprite attackSprite_;
     std::unique_ptr<AnimationComponent> attackAnimation_;
 
+    // Clips of the sword and of the swoosh (attack clips sped up with the attack speed)
+    ClipID attackClip_;
+    ClipID idleClip_;
+    ClipID swooshAttackClip_;
+    ClipID swooshIdleClip_;
+    float attackAnimationSpeed_ = 1.0f;
+
     const sf::Sprite& playerSprite_;
     const std::map<Direction, Vector> offsets_;
     std::unique_ptr<HitboxComponent> attackHitbox_;
@@ -164,7 +164,7 @@ void gui::Button::update(const float& dt)
  *  @brief Function that renders the button
  *  @param target   RenderWindow where the state will be drawn
  */
-void gui::Button::render(std::shared_ptr<sf::RenderTarget> target)
+void gui::Button::render(std::shared_ptr<RenderSnapshot> target)
 {
     if (target)
     {
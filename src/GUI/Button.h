@@ -34,7 +34,7 @@ namespace gui
         // Functions
         virtual void updateMousePosition(const Vector& mousePosition);
         virtual void update(const float& dt);
-        virtual void render(std::shared_ptr<sf::RenderTarget> target);
+        virtual void render(std::shared_ptr<RenderSnapshot> target);
         virtual void addTexture(std::shared_ptr<sf::Texture> texture);
 
         // Getters
@@ -77,7 +77,7 @@ void gui::DropDownList::update(const float& dt)
  * @brief Function that renders the drop down list
  * @param target            Where to draw the list
  */
-void gui::DropDownList::render(std::shared_ptr<sf::RenderTarget> target)
+void gui::DropDownList::render(std::shared_ptr<RenderSnapshot> target)
 {
     if (dropDown_)
     {
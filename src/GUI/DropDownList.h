@@ -19,7 +19,7 @@ namespace gui
             virtual ~DropDownList();
 
             virtual void update(const float& dt);
-            virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);     
+            virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);     
             virtual void updateMousePosition(Vector mousePosition);
 
             virtual void addElement(const std::string& name);
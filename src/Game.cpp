@@ -1,10 +1,13 @@
 #include "headers.h"
 #include "Game.h"
+#include "Profiling/Profiler.h"
 
 
 /// Constructor
 Game::Game()
     :   videoModes_(sf::VideoMode::getFullscreenModes())
+    ,   dt_(0.0f)
+    ,   accumulator_(0.0f)
 {
     initWindow();
     initKeyInputs(); 
@@ -14,7 +17,9 @@ Game::Game()
 /// Destructor
 Game::~Game()
 {
-
+    // Before the states : the last frames can use their textures
+    renderThread_.reset();
+    ResourceCache::clear();
 }
 
 /**
@@ -26,6 +31,15 @@ void Game::endApplication()
     std::cout << "Ending application" << std::endl;
 }
 
+/**
+ * @brief Function that stops the render thread and closes the window
+ */
+void Game::close()
+{
+    renderThread_.reset();
+    window_->close();
+}
+
 /**
  * @brief Function that handles every sfml events
  */
@@ -35,7 +49,7 @@ void Game::handleEvents()
     {
         if (event_.type == sf::Event::Closed)
         {
-            window_->close();
+            close();
         }
     }
 }
@@ -46,52 +60,59 @@ void Game::handleEvents()
 void Game::updateTime()
 {
     dt_ = dtClock_.restart().asSeconds();
+    accumulator_ = std::min(accumulator_ + dt_, MAX_STEPS_PER_FRAME * TIME_STEP);
 }
 
 /**
- * @brief Function that updates the application
+ * @brief Function that updates the application by one simulation step
+ * @param dt            Duration of the step
  */
-void Game::update() 
+void Game::update(const float& dt) 
 {
-    if (fpsClock_.getElapsedTime().asSeconds() > 1.00)
-    {
-        std::cout << "FPS : " << (1.0f / (dt_)) << std::endl;
-        fpsClock_.restart();
-    }
-    
-    handleEvents();
-    
+    ProfileZone zone("Game::update");
+
     if (!states.empty())
     {
-        states.top()->update(dt_);
+        states.top()->update(dt);
         if (states.top()->getQuit())
         {
-            states.top()->endState();
+            std::unique_ptr<State> next = states.top()->takeNextState();
+
+            // The frames recorded can use the textures and fonts of the state
+            renderThread_->flush();
             states.pop();
+
+            if (next)
+                states.push(std::move(next));
         }
     }
     else
     {
         std::cout << "No more states - Application ending...\n";
         endApplication();
-        window_->close();
+        close();
     }
 
 }
 
 /**
- * @brief Function that renders every frame
+ * @brief Function that records the frame and gives it to the render thread
+ * @param alpha         Time since the last simulation step (fraction of a step)
  */
-void Game::render()
+void Game::render(const float& alpha)
 {
-    window_->clear();
+    ProfileZone zone("Game::render");
+
+    std::shared_ptr<RenderSnapshot> snapshot = renderThread_->beginFrame();
+    snapshot->setView(window_->getDefaultView());
 
     if (!states.empty())
     {
-        states.top()->render(window_);
+        states.top()->setInterpolation(alpha);
+        states.top()->render(snapshot);
     }
 
-    window_->display();
+    renderThread_->publish();
 }
 
 /**
@@ -99,11 +120,25 @@ void Game::render()
  */
 void Game::run()
 {
+    Profiler::setThreadName("main");
+    renderThread_ = std::make_unique<RenderThread>(*window_);
+
     while (window_->isOpen())
     {   
         updateTime();
-        update();
-        render();
+        handleEvents();
+
+        // Fixed steps : the simulation does not depend on the frame rate
+        while (accumulator_ >= TIME_STEP && window_->isOpen())
+        {
+            update(TIME_STEP);
+            accumulator_ -= TIME_STEP;
+        }
+
+        if (window_->isOpen())
+            render(accumulator_ / TIME_STEP);
+
+        Profiler::endFrame();
     }
 }
 
@@ -5,21 +5,26 @@
 #include "State/GameState.h"
 #include "State/MainMenuState.h"
 #include "Window.h"
+#include "Render/RenderThread.h"
 
 class Game
 {
 public:
 
+    static constexpr float TIME_STEP = 1.0f / 120.0f;     // Duration of a simulation step (in seconds)
+    static constexpr int MAX_STEPS_PER_FRAME = 8;           // Slower frames slow down the game instead of piling up steps
+
     // Constructor/Destructor
     Game();
     ~Game();
     
     // Functions
     void endApplication();
+    void close();
     void handleEvents();
     void updateTime();
-    void update();
-    void render();
+    void update(const float& dt);
+    void render(const float& alpha);
     void run();
 
 private:
@@ -35,8 +40,11 @@ private:
     std::vector<sf::VideoMode> videoModes_;
 
     float dt_;
+    float accumulator_;         // Time not simulated yet (less than a step after the updates of a frame)
     sf::Clock dtClock_;
-    sf::Clock fpsClock_;
+
+    // Draws the frames recorded by the states (created by run)
+    std::unique_ptr<RenderThread> renderThread_;
 
     // States of the game
     std::stack<std::unique_ptr<State>> states;
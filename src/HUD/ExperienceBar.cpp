@@ -44,7 +44,7 @@ void HUD::ExperienceBar::update(const float& dt)
  * @brief Function that draws the player on the window
  * @param window    Window where the player will be drawn into
  */
-void HUD::ExperienceBar::render(std::shared_ptr<sf::RenderTarget> target)
+void HUD::ExperienceBar::render(std::shared_ptr<RenderSnapshot> target)
 {
     target->draw(insideBar_);
     target->draw(bar_);
@@ -14,7 +14,7 @@ namespace HUD {
 
 
         virtual void update(const float& dt);
-        virtual void render(std::shared_ptr<sf::RenderTarget> target);
+        virtual void render(std::shared_ptr<RenderSnapshot> target);
 
         // Getters
         virtual float getExperience()
@@ -38,7 +38,7 @@ void HUD::InventoryBar::update(const float& dt)
  * @brief Function that renders the bar
  * @param target    Where to draw the bar
  */
-void HUD::InventoryBar::render(std::shared_ptr<sf::RenderTarget> target)
+void HUD::InventoryBar::render(std::shared_ptr<RenderSnapshot> target)
 {
     target->draw(background_);
     
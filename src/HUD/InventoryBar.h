@@ -17,7 +17,7 @@ namespace HUD
         virtual ~InventoryBar();
 
         virtual void update(const float& dt);
-        virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
+        virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
 
     private:
 
@@ -0,0 +1,93 @@
+#include "../headers.h"
+#include "ProfilerOverlay.h"
+
+/**
+ * @brief Constructor
+ * @param font      Font of the text
+ * @param position  Position of the topleft corner of the panel
+ */
+HUD::ProfilerOverlay::ProfilerOverlay(sf::Font& font, const Vector& position)
+    :   refreshTimer_(0.0f)
+{
+    background_.setFillColor(sf::Color(0, 0, 0, 160));
+    background_.setPosition(position.getAsVector2f());
+
+    text_.setFont(font);
+    text_.setCharacterSize(CHARACTER_SIZE);
+    text_.setFillColor(sf::Color::White);
+    text_.setPosition((position + Vector(8.0f, 8.0f)).getAsVector2f());
+
+    refresh();
+}
+
+/**
+ * @brief Function that refreshes the text a few times per second (readable while the values change)
+ * @param dt        Time since last frame
+ */
+void HUD::ProfilerOverlay::update(const float& dt)
+{
+    refreshTimer_ += dt;
+    if (refreshTimer_ >= REFRESH_PERIOD)
+    {
+        refreshTimer_ = 0.0f;
+        refresh();
+    }
+}
+
+/**
+ * @brief Function that writes the values of the profiler in the text and fits the panel around it
+ */
+void HUD::ProfilerOverlay::refresh()
+{
+    FramePercentiles frame = Profiler::getFramePercentiles();
+    FrameStats pacing = Profiler::getFrameStats();
+
+    std::ostringstream stream;
+    stream << std::fixed << std::setprecision(2)
+           << "frame  p50 " << frame.p50 << "  p95 " << frame.p95 << "  p99 " << frame.p99 << " ms\n"
+           << "FPS " << pacing.frames << "  avg " << pacing.average << "  min " << pacing.minimum
+           << "  max " << pacing.maximum << "  p99 " << pacing.percentile99 << " ms\n"
+           << "waiting  simulation " << pacing.simulationWait << "  render " << pacing.renderWait << " ms\n";
+
+    // Counters named group/counter are written on the line of their group
+    std::string group;
+    for (const auto& counter : Profiler::getCounters())
+    {
+        std::size_t separator = counter.first.find('/');
+        std::string name = counter.first.substr(0, separator);
+        if (separator == std::string::npos || name != group)
+        {
+            stream << (group.empty() ? "" : "\n") << name;
+            group = separator == std::string::npos ? "" : name;
+        }
+
+        if (separator == std::string::npos)
+            stream << "  " << counter.second << "\n";
+        else
+            stream << "  " << counter.first.substr(separator + 1) << " " << counter.second;
+    }
+    if (!group.empty())
+        stream << "\n";
+
+    stream << "\nzone (ms per frame, max, calls)\n";
+    for (const auto& zone : Profiler::getZones())
+    {
+        stream << zone.first << "  " << zone.second.average << "  " << zone.second.maximum
+               << "  " << std::setprecision(1) << zone.second.calls << std::setprecision(2) << "\n";
+    }
+
+    text_.setString(stream.str());
+
+    sf::FloatRect bounds = text_.getLocalBounds();
+    background_.setSize(sf::Vector2f(bounds.left + bounds.width + 16.0f, bounds.top + bounds.height + 16.0f));
+}
+
+/**
+ * @brief Function that draws the panel
+ * @param target    Where to draw the panel
+ */
+void HUD::ProfilerOverlay::render(std::shared_ptr<RenderSnapshot> target)
+{
+    target->draw(background_);
+    target->draw(text_);
+}
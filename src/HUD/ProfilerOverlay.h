@@ -0,0 +1,36 @@
+#ifndef PROFILER_OVERLAY_H
+#define PROFILER_OVERLAY_H
+
+#include "../Drawable.h"
+#include "../Profiling/Profiler.h"
+
+namespace HUD {
+
+    // Debug panel : time per frame of each zone, frame time percentiles, frame pacing of the render thread and counters of the profiler
+    class ProfilerOverlay
+        :   public Drawable
+    {
+    public:
+
+        static constexpr float REFRESH_PERIOD = 0.25f;      // Seconds between two refreshes of the text
+        static constexpr unsigned int CHARACTER_SIZE = 14;
+
+        ProfilerOverlay(sf::Font& font, const Vector& position);
+        virtual ~ProfilerOverlay() {};
+
+        virtual void update(const float& dt);
+        virtual void render(std::shared_ptr<RenderSnapshot> target);
+
+        void refresh();
+
+    private:
+
+        float refreshTimer_;
+
+        sf::RectangleShape background_;
+        sf::Text text_;
+
+    };
+}
+
+#endif
@@ -0,0 +1,94 @@
+#include "../headers.h"
+#include "BiomeTable.h"
+
+/**
+ * @brief Constructor
+ * @param path          Path of the file describing the biomes
+ */
+BiomeTable::BiomeTable(const std::string& path)
+{
+    load(path);
+}
+
+/**
+ * @brief Destructor
+ */
+BiomeTable::~BiomeTable()
+{
+
+}
+
+/**
+ * @brief Function that returns the first biome matching a tile
+ * @param height            Height of the tile
+ * @param moisture          Moisture of the tile
+ * @param temperature       Temperature of the tile
+ * @return                  Index of the biome (the last biome if none matches)
+ */
+std::size_t BiomeTable::find(float height, float moisture, float temperature) const
+{
+    for (std::size_t i = 0; i < biomes_.size(); ++i)
+    {
+        const Biome& biome = biomes_[i];
+        if (height <= biome.maxHeight &&
+            moisture >= biome.minMoisture && moisture <= biome.maxMoisture &&
+            temperature >= biome.minTemperature && temperature <= biome.maxTemperature)
+            return i;
+    }
+
+    return biomes_.size() - 1;
+}
+
+/**
+ * @brief Function that returns a biome
+ * @param index             Index of the biome
+ */
+const Biome& BiomeTable::get(std::size_t index) const
+{
+    return biomes_[index];
+}
+
+/**
+ * @brief Function that returns the number of biomes
+ */
+std::size_t BiomeTable::size() const
+{
+    return biomes_.size();
+}
+
+/**
+ * @brief Function that loads the biomes
+ * Each line is : name maxHeight minMoisture maxMoisture minTemperature maxTemperature ground variants bush tree bigTree
+ * A ground with several variants uses the tiles ground_0, ground_1, ...
+ * @param path              Path of the file describing the biomes
+ */
+void BiomeTable::load(const std::string& path)
+{
+    std::ifstream file(path);
+    Biome biome;
+    std::string ground;
+    int variants;
+
+    while (file >> biome.name >> biome.maxHeight
+                >> biome.minMoisture >> biome.maxMoisture
+                >> biome.minTemperature >> biome.maxTemperature
+                >> ground >> variants
+                >> biome.bush >> biome.tree >> biome.bigTree)
+    {
+        biome.ground.clear();
+        if (variants <= 1)
+        {
+            biome.ground.push_back(TileHandler::getID(ground));
+        }
+        else
+        {
+            for (int i = 0; i < variants; ++i)
+                biome.ground.push_back(TileHandler::getID(ground + "_" + std::to_string(i)));
+        }
+
+        biomes_.push_back(biome);
+    }
+
+    if (biomes_.empty())
+        throw("Error : Could not load the biomes");
+}
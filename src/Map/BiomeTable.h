@@ -0,0 +1,44 @@
+#ifndef BIOME_TABLE_H
+#define BIOME_TABLE_H
+
+#include "TileHandler.h"
+
+// Kind of terrain chosen from the height, the moisture and the temperature of a tile
+struct Biome
+{
+    std::string name;
+    float maxHeight;
+    float minMoisture;
+    float maxMoisture;
+    float minTemperature;
+    float maxTemperature;
+
+    // Ground tile (one of the variants is picked with the grass noise)
+    std::vector<TileID> ground;
+
+    // Probability of each natural element on a tile
+    float bush;
+    float tree;
+    float bigTree;
+};
+
+// Ordered list of biomes : a tile gets the first biome matching its height, moisture and temperature
+class BiomeTable
+{
+public:
+
+    BiomeTable(const std::string& path);
+    virtual ~BiomeTable();
+
+    std::size_t find(float height, float moisture, float temperature) const;
+    const Biome& get(std::size_t index) const;
+    std::size_t size() const;
+
+private:
+
+    void load(const std::string& path);
+
+    std::vector<Biome> biomes_;
+};
+
+#endif
@@ -1,24 +1,34 @@
 #include "../headers.h"
 #include "Chunk.h"
+#include "../Profiling/Profiler.h"
 
 const float Chunk::DEFAULT_SIZE = 16.0f;
 
 /**
  * @brief Constructor
- * @param perlinNoise           Perlin noise object for tile generation
- * @param position              Chunk's position
+ * @param textureSheet          Texture sheet of the tiles
+ * @param terrainGenerator      Terrain generator for tile generation
+ * @param coord                 Chunk's coordinates (in chunks)
  * @param size                  Chunk's size (in number of tiles)
  * @param tileSize              Size of each tile
  */
-Chunk::Chunk(std::shared_ptr<sf::Texture> textureSheet, TerrainGenerator& terrainGenerator, const Vector& position, const Vector& size, const Vector& tileSize)
+Chunk::Chunk(std::shared_ptr<sf::Texture> textureSheet, const TerrainGenerator& terrainGenerator, const ChunkCoord& coord, const Vector& size, const Vector& tileSize)
     :   terrainGenerator_(terrainGenerator)
-    ,   position_(position)
+    ,   coord_(coord)
+    ,   position_(coord.toPosition(size, tileSize))
     ,   size_(size)
     ,   tileSize_(tileSize)
+    ,   width_(static_cast<int>(size.getX()))
+    ,   height_(static_cast<int>(size.getY()))
     ,   textureSheet_(textureSheet)
+    ,   tilesVertices_(sf::Quads)
+    ,   natureVertices_(sf::Quads)
+    ,   tilesChanged_(false)
+    ,   natureChanged_(false)
 {
     initTerrain();
     //generateSmoothTextures();
+    buildVertices();
 }
 
 /**
@@ -42,74 +52,164 @@ void Chunk::update(const float& dt)
  * @brief Function that renders the tile
  * @param target        Where to draw the tile
  */
-void Chunk::render(std::shared_ptr<sf::RenderTarget> target)
+void Chunk::render(std::shared_ptr<RenderSnapshot> target)
 {
-
-    // Rendering tiles
-    for (const auto& tile : tiles_)
+    if (tilesChanged_)
     {
-        sf::Sprite s = TileHandler::getSpriteFromChar(tile.second, textureSheet_);
-        s.setPosition(tile.first.getAsVector2f());
-        target->draw(s);
+        buildLayer(tiles_, tilesVertices_);
+        tilesChanged_ = false;
     }
 
+    target->draw(tilesVertices_, textureSheet_.get());
 }
 
 /**
  * @brief Function that renders the tile on top
  * @param target        Where to draw the tile
  */
-void Chunk::renderOnTop(std::shared_ptr<sf::RenderTarget> target)
+void Chunk::renderOnTop(std::shared_ptr<RenderSnapshot> target)
 {
-    // Rendering tiles
-    for (const auto& tile : nature_)
+    if (natureChanged_)
     {
-        sf::Sprite s = TileHandler::getSpriteFromChar(tile.second, textureSheet_);
-        s.setPosition(tile.first.getAsVector2f());
-        target->draw(s);
+        buildLayer(nature_, natureVertices_);
+        natureChanged_ = false;
     }
 
+    target->draw(natureVertices_, textureSheet_.get());
 }
 
 /**
- * @brief Function that collides a hitbox with the chunk
- * @param hitbox        Hitbox
- * @return              Push that must be applied to the hitbox
+ * @brief Function that removes the bushes walked on
+ * @param area          Hitbox walking on the chunk
  */
-std::vector<Vector> Chunk::collide(const HitboxComponent& hitbox)
+void Chunk::trample(const sf::FloatRect& area)
 {
-    // Collisions with solid blocks
-    std::unordered_map<Vector, sf::FloatRect, VectorHasher> blocks = blocksColliding(hitbox);
-    std::vector<Vector> offsets;
-    for (const auto& block : blocks)
+    int firstX, firstY, lastX, lastY;
+    if (!getCellRange(area, firstX, firstY, lastX, lastY))
+        return;
+
+    for (int y = firstY; y <= lastY; ++y)
     {
-        offsets.push_back(CollisionHandler::collide(hitbox, block.second));
+        for (int x = firstX; x <= lastX; ++x)
+        {
+            std::size_t index = getIndex(x, y);
+            if (nature_[index] == GeneratedTiles::get().bush &&
+                area.intersects(sf::FloatRect(getPositionOfTile(x, y).getAsVector2f(), tileSize_.getAsVector2f())))
+            {
+                setTile(index, ON_TOP, TileHandler::NO_TILE);
+            }
+        }
     }
+}
 
-    // Collisions with tiles
-    std::unordered_map<Vector, std::string, VectorHasher> tiles = naturalElementsColliding(hitbox);
-    for (const auto& tile : tiles)
+/**
+ * @brief Function that returns the solid blocks colliding with an area
+ * Only the tiles that can hold a block overlapping the area are visited (see getColliderSearchArea)
+ * @param area          Area (usually a hitbox)
+ * @param blocks        Blocks colliding (added at the end, every block is reported)
+ */
+void Chunk::queryBlocks(const sf::FloatRect& area, std::vector<sf::FloatRect>& blocks) const
+{
+    int firstX, firstY, lastX, lastY;
+    if (!getCellRange(getColliderSearchArea(area, tileSize_), firstX, firstY, lastX, lastY))
+        return;
+
+    for (int y = firstY; y <= lastY; ++y)
     {
-        if (tile.second == "bush")
+        for (int x = firstX; x <= lastX; ++x)
         {
-            nature_.erase(tile.first);
+            std::size_t cell = getIndex(x, y);
+            for (std::uint32_t i = cellStart_[cell]; i < cellStart_[cell + 1]; ++i)
+            {
+                const sf::FloatRect& block = blocks_[i];
+                if (!area.intersects(block))
+                    continue;
+
+                // A block stored in several tiles is only reported from the first tile visited
+                int blockFirstX, blockFirstY, blockLastX, blockLastY;
+                getCellRange(block, blockFirstX, blockFirstY, blockLastX, blockLastY);
+                if (x != std::max(firstX, blockFirstX) || y != std::max(firstY, blockFirstY))
+                    continue;
+
+                blocks.push_back(block);
+            }
         }
     }
+}
 
-    return offsets;
+/**
+ * @brief Function that returns the area where the tiles of the colliders overlapping an area can be
+ * A tree trunk sticking out of the chunk is stored in its border tiles : an area just below or right of the chunk still finds it
+ * @param area          Area
+ * @param tileSize      Size of a tile
+ * @return              Area grown up and left by the largest overhang of a collider
+ */
+sf::FloatRect Chunk::getColliderSearchArea(const sf::FloatRect& area, const Vector& tileSize)
+{
+    float overhangX = MAX_COLLIDER_OVERHANG * tileSize.getX();
+    float overhangY = MAX_COLLIDER_OVERHANG * tileSize.getY();
+    return sf::FloatRect(area.left - overhangX, area.top - overhangY, area.width + overhangX, area.height + overhangY);
+}
+
+/**
+ * @brief Function that changes a tile of the chunk (the change is kept to be saved)
+ * @param localTile     Coordinates of the tile in the chunk
+ * @param layer         Layer of the tile
+ * @param tile          New tile
+ */
+void Chunk::setTile(const TileCoord& localTile, Layer layer, TileID tile)
+{
+    bool solidityChanged = TileHandler::isBlockSolid(tile) ||
+        TileHandler::isBlockSolid((layer == GROUND ? tiles_ : nature_)[getIndex(localTile.x, localTile.y)]);
+
+    setTile(getIndex(localTile.x, localTile.y), layer, tile);
+
+    if (solidityChanged)
+        rebuildBlocks();
+}
+
+/**
+ * @brief Function that applies changes saved previously to the generated chunk
+ * @param changes       Changes to apply
+ */
+void Chunk::applyChanges(const std::vector<TileChange>& changes)
+{
+    for (const TileChange& change : changes)
+    {
+        if (change.index < tiles_.size())
+            setTile(change.index, change.layer, change.tile);
+    }
+
+    rebuildBlocks();
+}
+
+/**
+ * @brief Function that returns the changes made to the chunk since its generation
+ */
+const std::vector<TileChange>& Chunk::getChanges() const
+{
+    return changes_;
+}
+
+/**
+ * @brief Function that returns whether the chunk differs from the generated terrain
+ */
+bool Chunk::isModified() const
+{
+    return !changes_.empty();
 }
 
 /**
  * @brief Function that returns the neighbours of a tile (order : b-t-r-l)
- * @param position      Position of the tile
+ * @param tile          Coordinates of the tile in the chunk
  * @return              Array containing the neighbouring tiles
  */
-std::array<Vector, 4> Chunk::getNeighbours(const Vector& position) const
+std::array<TileCoord, 4> Chunk::getNeighbours(const TileCoord& tile) const
 {
-    Vector bottom = position + Vector(0.0f, tileSize_.getY());
-    Vector top = position - Vector(0.0f, tileSize_.getY());
-    Vector right = position + Vector(tileSize_.getX(), 0.0f);
-    Vector left = position - Vector(tileSize_.getX(), 0.0f);
+    TileCoord bottom(tile.x, tile.y + 1);
+    TileCoord top(tile.x, tile.y - 1);
+    TileCoord right(tile.x + 1, tile.y);
+    TileCoord left(tile.x - 1, tile.y);
 
     return { bottom, top, right, left };
 }
@@ -120,7 +220,7 @@ std::array<Vector, 4> Chunk::getNeighbours(const Vector& position) const
  * @param x             X coordinate in the chunk (in tiles)
  * @param y             Y coordinate in the chunk (in tiles)
  */
-Vector Chunk::getPositionOfTile(std::size_t x, std::size_t y) const
+Vector Chunk::getPositionOfTile(int x, int y) const
 {
     float i = position_.getX() + static_cast<float>(x) * tileSize_.getX();
     float j = position_.getY() + static_cast<float>(y) * tileSize_.getY();
@@ -132,10 +232,28 @@ Vector Chunk::getPositionOfTile(std::size_t x, std::size_t y) const
  * @param globalPosition    Position of the tile
  * @return                  Tile
  */
-const std::string& Chunk::getTile(const Vector& globalPosition) const
+TileID Chunk::getTile(const Vector& globalPosition) const
 {
-    Vector localPosition = globalPosition - position_;
-    return tiles_.find(localPosition)->second;
+    return getTile(TileCoord::fromPosition(globalPosition - position_, tileSize_));
+}
+
+/**
+ * @brief Function that returns the tile at certain coordinates
+ * @param localTile         Coordinates of the tile in the chunk
+ * @return                  Tile
+ */
+TileID Chunk::getTile(const TileCoord& localTile) const
+{
+    return tiles_[getIndex(localTile.x, localTile.y)];
+}
+
+/**
+ * @brief Function that returns the coordinates of the chunk
+ * @return              Chunk's coordinates (in chunks)
+ */
+const ChunkCoord& Chunk::getCoord() const
+{
+    return coord_;
 }
 
 /**
@@ -177,121 +295,155 @@ const Vector& Chunk::getTileSize() const
 }
 
 /**
- * @brief Function that returns every tiles colliding with a hitbox
- * @param hitbox        Hitbox
- * @return              Tiles colliding
+ * @brief Function that returns the index of a tile in the layers
+ * @param x             X coordinate in the chunk (in tiles)
+ * @param y             Y coordinate in the chunk (in tiles)
  */
-std::unordered_map<Vector, sf::FloatRect, VectorHasher> Chunk::blocksColliding(const HitboxComponent& hitbox) const
-{   
-    std::unordered_map<Vector, sf::FloatRect, VectorHasher> tilesColliding;
-    for (const auto& tile : blocks_)
-    {
-        if (hitbox.isIntersecting(tile.second))
-        {
-            tilesColliding.emplace(tile.first, tile.second);
-        }
-    }
+std::size_t Chunk::getIndex(int x, int y) const
+{
+    return static_cast<std::size_t>(y * width_ + x);
+}
 
-    return tilesColliding;
+/**
+ * @brief Function that returns whether coordinates are inside the chunk
+ * @param localTile     Coordinates of the tile in the chunk
+ */
+bool Chunk::isInside(const TileCoord& localTile) const
+{
+    return localTile.x >= 0 && localTile.x < width_ && localTile.y >= 0 && localTile.y < height_;
 }
 
 /**
- * @brief Function that returns every tiles colliding with a hitbox
- * @param hitbox        Hitbox
- * @return              Tiles colliding
+ * @brief Function that changes a tile and records the change
+ * @param index         Index of the tile in the layer
+ * @param layer         Layer of the tile
+ * @param tile          New tile
  */
-std::unordered_map<Vector, std::string, VectorHasher> Chunk::naturalElementsColliding(const HitboxComponent& hitbox) const
-{   
-    std::unordered_map<Vector, std::string, VectorHasher> tilesColliding;
-    for (const auto& tile : nature_)
+void Chunk::setTile(std::size_t index, Layer layer, TileID tile)
+{
+    if (layer == GROUND)
     {
-        if (hitbox.isIntersecting(sf::FloatRect(tile.first.getAsVector2f(), tileSize_.getAsVector2f())))
-        {
-            tilesColliding.emplace(tile.first, tile.second);
-        }
+        tiles_[index] = tile;
+        tilesChanged_ = true;
     }
+    else
+    {
+        nature_[index] = tile;
+        natureChanged_ = true;
+    }
+
+    auto change = std::find_if(changes_.begin(), changes_.end(), [&] (const TileChange& c) {
+        return c.index == index && c.layer == layer;
+    });
 
-    return tilesColliding;
+    if (change != changes_.end())
+        change->tile = tile;
+    else
+        changes_.push_back(TileChange { static_cast<std::uint16_t>(index), layer, tile });
 }
 
 /**
- * @brief Function that generates the chunk with perlin noise
+ * @brief Function that returns the part of a tile the entities collide with
+ * @param tile          Solid tile
+ * @param position      Position of the tile
+ * @return              Collider
  */
-void Chunk::initTerrain()
+sf::FloatRect Chunk::getCollider(TileID tile, const Vector& position) const
 {
-    tiles_.reserve(size_.getX() * size_.getY());
-
-    for (std::size_t i = 0; static_cast<float>(i) < size_.getX(); ++i)
-    {
-        for (std::size_t j = 0; static_cast<float>(j) < size_.getY(); ++j)
-        {
-            Vector pos = getPositionOfTile(i, j);
-            
-            Vector terrainPosition = Vector(pos.getX() / (tileSize_.getX() * 64.0f), pos.getY() / (tileSize_.getY() * 64.0f));
+    const GeneratedTiles& generated = GeneratedTiles::get();
 
-            float value = terrainGenerator_.mapValue(terrainPosition);
+    // Only the trunk of the trees is solid
+    if (tile == generated.tree)
+        return sf::FloatRect((position + Vector(0.0f, tileSize_.getY())).getAsVector2f(), tileSize_.getAsVector2f());
 
-            addTile(pos, value);   
+    if (tile == generated.bigTree)
+        return sf::FloatRect((position + Vector(0.5f * tileSize_.getX(), 2.0f * tileSize_.getY())).getAsVector2f(), tileSize_.getAsVector2f());
 
-            if (value >= TerrainGenerator::GRASS_HEIGHT)
-                generateNaturalElements(pos, terrainGenerator_.generateNaturalElement(pos));
-        }
-    }
+    return sf::FloatRect(position.getAsVector2f(), tileSize_.getAsVector2f());
 }
 
 /**
- * @brief Function that adds a tile to the chunk at a certain position
- * @param position      Position of the tile
- * @param height        Height used to determine the tile's type
+ * @brief Function that computes the solid blocks from the layers
  */
-void Chunk::addTile(const Vector& position, const float& height)
+void Chunk::rebuildBlocks()
 {
-
-    if (height <= TerrainGenerator::WATER_HEIGHT)
+    std::vector<sf::FloatRect> colliders;
+    for (int y = 0; y < height_; ++y)
     {
-        tiles_.emplace(position, "water");
-        blocks_.emplace(position, sf::FloatRect(position.getAsVector2f(), tileSize_.getAsVector2f()));
+        for (int x = 0; x < width_; ++x)
+        {
+            std::size_t index = getIndex(x, y);
+            Vector position = getPositionOfTile(x, y);
+
+            if (TileHandler::isBlockSolid(tiles_[index]))
+                colliders.push_back(getCollider(tiles_[index], position));
+
+            if (TileHandler::isBlockSolid(nature_[index]))
+                colliders.push_back(getCollider(nature_[index], position));
+        }
     }
-    else if (height <= TerrainGenerator::SAND_HEIGHT)
+
+    // Counting the blocks of each tile, then placing them (compressed rows)
+    cellStart_.assign(tiles_.size() + 1, 0);
+    for (const sf::FloatRect& collider : colliders)
     {
-        tiles_.emplace(position, "sand");
+        int firstX, firstY, lastX, lastY;
+        getCellRange(collider, firstX, firstY, lastX, lastY);
+
+        for (int y = firstY; y <= lastY; ++y)
+            for (int x = firstX; x <= lastX; ++x)
+                ++cellStart_[getIndex(x, y) + 1];
     }
-    else if (height <= TerrainGenerator::GRASS_HEIGHT)
+
+    std::partial_sum(cellStart_.begin(), cellStart_.end(), cellStart_.begin());
+    blocks_.resize(cellStart_.back());
+
+    std::vector<std::uint32_t> next(cellStart_.begin(), cellStart_.end() - 1);
+    for (const sf::FloatRect& collider : colliders)
     {
-        // Normal grass
-        tiles_.emplace(position, "grass_" + std::to_string(terrainGenerator_.generateGrass(position)));
+        int firstX, firstY, lastX, lastY;
+        getCellRange(collider, firstX, firstY, lastX, lastY);
+
+        for (int y = firstY; y <= lastY; ++y)
+            for (int x = firstX; x <= lastX; ++x)
+                blocks_[next[getIndex(x, y)]++] = collider;
     }
-    else 
-        tiles_.emplace(position, "grass_" + std::to_string(terrainGenerator_.generateGrass(position)));
 }
 
 /**
- * @brief Funciont that generates trees at a depending on a certain height
- * @param position      Position of the tree
- * @param height         Height used to determine if a tree can be added or not
+ * @brief Function that returns the tiles of the chunk overlapping an area
+ * @param area          Area (global position)
+ * @param firstX        First column overlapped
+ * @param firstY        First row overlapped
+ * @param lastX         Last column overlapped
+ * @param lastY         Last row overlapped
+ * @return              Whether the area overlaps the chunk (the range is clamped to the chunk anyway)
  */
-void Chunk::generateNaturalElements(const Vector& position, int type)
+bool Chunk::getCellRange(const sf::FloatRect& area, int& firstX, int& firstY, int& lastX, int& lastY) const
 {
-    switch (type) 
-    {
-        case 1:
-            nature_.try_emplace(position, "bush");
-            break;
-        
-        case 2:
-            nature_.emplace(position, "tree");
-            blocks_.emplace(position, sf::FloatRect((position + Vector(0.0f, tileSize_.getY())).getAsVector2f(), tileSize_.getAsVector2f()));
-            break;
-
-        case 3:
-            nature_.emplace(position, "big_tree");
-            blocks_.emplace(position, sf::FloatRect((position + Vector(0.5f * tileSize_.getX(), 2.0f * tileSize_.getY())).getAsVector2f(), tileSize_.getAsVector2f()));
-            break;
-
-        default:
-            break;
-    }
+    firstX = static_cast<int>(std::floor((area.left - position_.getX()) / tileSize_.getX()));
+    firstY = static_cast<int>(std::floor((area.top - position_.getY()) / tileSize_.getY()));
+    lastX = static_cast<int>(std::floor((area.left + area.width - position_.getX()) / tileSize_.getX()));
+    lastY = static_cast<int>(std::floor((area.top + area.height - position_.getY()) / tileSize_.getY()));
+
+    bool overlapping = lastX >= 0 && lastY >= 0 && firstX < width_ && firstY < height_;
+
+    // Areas sticking out of the chunk are clamped to its border tiles (a tree trunk can be below the last row)
+    firstX = std::min(std::max(firstX, 0), width_ - 1);
+    firstY = std::min(std::max(firstY, 0), height_ - 1);
+    lastX = std::min(std::max(lastX, 0), width_ - 1);
+    lastY = std::min(std::max(lastY, 0), height_ - 1);
+    return overlapping;
+}
 
+/**
+ * @brief Function that generates the chunk with the terrain generator
+ */
+void Chunk::initTerrain()
+{
+    ProfileZone zone("Chunk::initTerrain");
+    terrainGenerator_.generate(position_, tileSize_.getX(), width_, height_, tiles_, nature_);
+    rebuildBlocks();
 }
 
 /**
@@ -299,48 +451,100 @@ void Chunk::generateNaturalElements(const Vector& position, int type)
  */
 void Chunk::generateSmoothTextures() 
 {
-    for (auto& tile : tiles_)
+    const GeneratedTiles& generated = GeneratedTiles::get();
+    std::vector<TileID> smoothTiles = tiles_;
+
+    for (int y = 0; y < height_; ++y)
     {
-        if (tile.second == "sand")
+        for (int x = 0; x < width_; ++x)
         {
-            std::array<Vector, 4> neighbours = getNeighbours(tile.first);
-            std::array<std::string, 4> tiles;
+            if (tiles_[getIndex(x, y)] != generated.sand)
+                continue;
 
-            std::transform(neighbours.begin(), neighbours.end(), tiles.begin(), [&] (const Vector& v) {
-                const auto& tile = tiles_.find(v);
-                if (tile != tiles_.end())
+            std::array<TileCoord, 4> neighbours = getNeighbours(TileCoord(x, y));
+            std::array<TileID, 4> tiles;
+
+            std::transform(neighbours.begin(), neighbours.end(), tiles.begin(), [&] (const TileCoord& c) {
+                if (isInside(c))
                 {
-                    return tile->second; 
+                    return tiles_[getIndex(c.x, c.y)];
                 }
-                return std::string("INVALID");
+                return TileHandler::NO_TILE;
             });
 
             std::string newTile = "sand";
 
-            if (tiles[0] == "water")
+            if (tiles[0] == generated.water)
             {
                 // Bottom tile
                 newTile += "_down";
             }
-            else if (tiles[1] == "water")
+            else if (tiles[1] == generated.water)
             {
                 // Top tile
                 newTile += "_up";
             }
 
-            if (tiles[2] == "water")
+            if (tiles[2] == generated.water)
             {
                 // Right tile
                 newTile += "_right";
             }
-            else if (tiles[3] == "water")
+            else if (tiles[3] == generated.water)
             {
                 // Left tile
                 newTile += "_left";
             }
 
-            tiles_[tile.first] = newTile;
+            smoothTiles[getIndex(x, y)] = TileHandler::getID(newTile);
         }
     }
 
+    tiles_ = std::move(smoothTiles);
+}
+
+/**
+ * @brief Function that builds the geometry of every layer of the chunk
+ */
+void Chunk::buildVertices()
+{
+    buildLayer(tiles_, tilesVertices_);
+    buildLayer(nature_, natureVertices_);
+}
+
+/**
+ * @brief Function that builds the geometry of a layer (one textured quad per tile)
+ * so that the whole layer can be drawn in a single draw call
+ * @param layer         Tiles of the layer
+ * @param vertices      Vertex array to fill
+ */
+void Chunk::buildLayer(const std::vector<TileID>& layer, sf::VertexArray& vertices) const
+{
+    // Rows are visited from top to bottom so that tall elements (trees) overlap the ones behind them
+    vertices.clear();
+    for (int y = 0; y < height_; ++y)
+    {
+        for (int x = 0; x < width_; ++x)
+        {
+            TileID tile = layer[getIndex(x, y)];
+            if (tile == TileHandler::NO_TILE)
+                continue;
+
+            const TileInfo& info = TileHandler::getTileInfo(tile);
+
+            float left = static_cast<float>(info.textureRect.left);
+            float top = static_cast<float>(info.textureRect.top);
+            float right = left + static_cast<float>(info.textureRect.width);
+            float bottom = top + static_cast<float>(info.textureRect.height);
+
+            Vector position = getPositionOfTile(x, y);
+            Vector size(info.footprint.getX() * tileSize_.getX(), info.footprint.getY() * tileSize_.getY());
+            float px = position.getX(), py = position.getY();
+
+            vertices.append(sf::Vertex(sf::Vector2f(px, py), sf::Vector2f(left, top)));
+            vertices.append(sf::Vertex(sf::Vector2f(px + size.getX(), py), sf::Vector2f(right, top)));
+            vertices.append(sf::Vertex(sf::Vector2f(px + size.getX(), py + size.getY()), sf::Vector2f(right, bottom)));
+            vertices.append(sf::Vertex(sf::Vector2f(px, py + size.getY()), sf::Vector2f(left, bottom)));
+        }
+    }
 }
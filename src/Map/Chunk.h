@@ -5,9 +5,18 @@
 
 #include "TileHandler.h"
 #include "CollisionHandler.h"
+#include "Coordinates.h"
 #include "../Entities/HitboxComponent.h"
 #include "TerrainGenerator.h"
 
+// Modification of a tile since the chunk was generated
+struct TileChange
+{
+    std::uint16_t index;    // Index of the tile in the layer
+    Layer layer;
+    TileID tile;            // New tile
+};
+
 class Chunk
     :   public Drawable
 {
@@ -15,22 +24,32 @@ class Chunk
 public:
 
     static const float DEFAULT_SIZE;
+    static constexpr float MAX_COLLIDER_OVERHANG = 2.0f;     // Tiles a collider sticks out of its tile, down and right (trunk of a big tree)
 
     Chunk(std::shared_ptr<sf::Texture> textureSheet, 
-            TerrainGenerator& terrainGenerator, 
-            const Vector& position, const Vector& size = Vector(DEFAULT_SIZE), 
+            const TerrainGenerator& terrainGenerator, 
+            const ChunkCoord& coord, const Vector& size = Vector(DEFAULT_SIZE), 
             const Vector& tileSize = Vector(TileHandler::DEFAULT_SIZE));
     virtual ~Chunk();
 
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
-    virtual void renderOnTop(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
+    virtual void renderOnTop(std::shared_ptr<RenderSnapshot> target = nullptr);
+
+    void trample(const sf::FloatRect& area);
+    void queryBlocks(const sf::FloatRect& area, std::vector<sf::FloatRect>& blocks) const;
+    static sf::FloatRect getColliderSearchArea(const sf::FloatRect& area, const Vector& tileSize);
 
-    std::vector<Vector> collide(const HitboxComponent& hitbox);
+    void setTile(const TileCoord& localTile, Layer layer, TileID tile);
+    void applyChanges(const std::vector<TileChange>& changes);
+    const std::vector<TileChange>& getChanges() const;
+    bool isModified() const;
 
-    std::array<Vector, 4> getNeighbours(const Vector& position) const;
-    Vector getPositionOfTile(std::size_t x, std::size_t y) const;
-    const std::string& getTile(const Vector& globalPosition) const ;
+    std::array<TileCoord, 4> getNeighbours(const TileCoord& tile) const;
+    Vector getPositionOfTile(int x, int y) const;
+    TileID getTile(const Vector& globalPosition) const;
+    TileID getTile(const TileCoord& localTile) const;
+    const ChunkCoord& getCoord() const;
     Vector getPosition() const;
     sf::FloatRect getRectangle() const;
     const Vector& getSize() const;
@@ -38,23 +57,45 @@ public:
 
 private:
 
-    std::unordered_map<Vector, sf::FloatRect, VectorHasher> blocksColliding(const HitboxComponent& hitbox) const;
-    std::unordered_map<Vector, std::string, VectorHasher> naturalElementsColliding(const HitboxComponent& hitbox) const;
+    std::size_t getIndex(int x, int y) const;
+    bool isInside(const TileCoord& localTile) const;
+
+    bool getCellRange(const sf::FloatRect& area, int& firstX, int& firstY, int& lastX, int& lastY) const;
+    void setTile(std::size_t index, Layer layer, TileID tile);
+    sf::FloatRect getCollider(TileID tile, const Vector& position) const;
+    void rebuildBlocks();
     void initTerrain();
-    void addTile(const Vector& position, const float& height);
-    void generateNaturalElements(const Vector& position, const int height);
     void generateSmoothTextures();
+    void buildVertices();
+    void buildLayer(const std::vector<TileID>& layer, sf::VertexArray& vertices) const;
 
-    TerrainGenerator& terrainGenerator_;
+    const TerrainGenerator& terrainGenerator_;
+    ChunkCoord coord_;
     Vector position_;
     Vector size_;
     Vector tileSize_;
+    int width_;
+    int height_;
     std::shared_ptr<sf::Texture> textureSheet_;
 
-    std::unordered_map<Vector, std::string, VectorHasher, VectorEqual> tiles_;
-    std::unordered_map<Vector, std::string, VectorHasher, VectorEqual> nature_;
-    std::unordered_map<Vector, sf::FloatRect, VectorHasher, VectorEqual> blocks_;
+    // Layers stored row by row (index = y * width + x), NO_TILE when there is no element
+    std::vector<TileID> tiles_;
+    std::vector<TileID> nature_;
+
+    // Solid rectangles indexed by tile : the blocks overlapping tile i are blocks_[cellStart_[i]] to blocks_[cellStart_[i + 1]]
+    // (a block overlapping several tiles is stored in each of them)
+    std::vector<sf::FloatRect> blocks_;
+    std::vector<std::uint32_t> cellStart_;
+
+    // Changes since generation (what is saved when the chunk is unloaded)
+    std::vector<TileChange> changes_;
+
+    // Cached geometry of each layer (one quad per tile), rebuilt when the layer changes
+    sf::VertexArray tilesVertices_;
+    sf::VertexArray natureVertices_;
+    bool tilesChanged_;
+    bool natureChanged_;
 };
 
 
-#endif
\ No newline at end of file
+#endif
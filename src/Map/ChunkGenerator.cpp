@@ -0,0 +1,184 @@
+#include "../headers.h"
+#include "ChunkGenerator.h"
+#include "../Profiling/Profiler.h"
+
+/**
+ * @brief Constructor
+ * @param textureSheet          Texture sheet of the tiles
+ * @param terrainGenerator      Terrain generator shared by every chunk
+ * @param regionStore           Saved changes applied to the generated chunks (optional)
+ * @param chunkSize             Size of a single chunk in tiles
+ * @param tileSize              Size of a single tile in pixel
+ * @param numberOfWorkers       Number of threads generating the chunks
+ */
+ChunkGenerator::ChunkGenerator(std::shared_ptr<sf::Texture> textureSheet, const TerrainGenerator& terrainGenerator, RegionStore* regionStore, const Vector& chunkSize, const Vector& tileSize, std::size_t numberOfWorkers)
+    :   textureSheet_(textureSheet)
+    ,   terrainGenerator_(terrainGenerator)
+    ,   regionStore_(regionStore)
+    ,   chunkSize_(chunkSize)
+    ,   tileSize_(tileSize)
+    ,   radius_(std::numeric_limits<float>::max())
+    ,   stopping_(false)
+{
+    for (std::size_t i = 0; i < numberOfWorkers; ++i)
+    {
+        workers_.emplace_back(&ChunkGenerator::work, this);
+    }
+}
+
+/**
+ * @brief Destructor (waits for the chunks being generated)
+ */
+ChunkGenerator::~ChunkGenerator()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stopping_ = true;
+    }
+    requestAvailable_.notify_all();
+
+    for (std::thread& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Function that asks for a chunk to be generated in the background
+ * @param coord         Coordinates of the chunk
+ */
+void ChunkGenerator::request(const ChunkCoord& coord)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!pending_.insert(coord).second)
+            return;
+
+        requests_.push_back(coord);
+    }
+    requestAvailable_.notify_one();
+}
+
+/**
+ * @brief Function that changes the position around which chunks are generated
+ * Requests farther than the radius are cancelled
+ * @param focus         Position of the player
+ * @param radius        Distance beyond which chunks are not needed anymore
+ */
+void ChunkGenerator::setFocus(const Vector& focus, float radius)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    focus_ = focus;
+    radius_ = radius;
+
+    auto cancelled = std::remove_if(requests_.begin(), requests_.end(), [&] (const ChunkCoord& coord) {
+        if (getDistanceToFocus(coord) <= radius_)
+            return false;
+
+        pending_.erase(coord);
+        return true;
+    });
+    requests_.erase(cancelled, requests_.end());
+
+    requestDone_.notify_all();
+}
+
+/**
+ * @brief Function that returns the chunks generated since the last call
+ * Must be called by the thread rendering the chunks (at a frame boundary)
+ * @return              Chunks generated
+ */
+std::vector<std::unique_ptr<Chunk>> ChunkGenerator::collect()
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    std::vector<std::unique_ptr<Chunk>> chunks;
+    chunks.swap(finished_);
+
+    for (const auto& chunk : chunks)
+        pending_.erase(chunk->getCoord());
+
+    return chunks;
+}
+
+/**
+ * @brief Function that waits until every requested chunk is generated
+ */
+void ChunkGenerator::wait()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    requestDone_.wait(lock, [this] () { return pending_.size() == finished_.size(); });
+}
+
+/**
+ * @brief Function that returns whether a chunk was requested and not collected yet
+ * @param coord         Coordinates of the chunk
+ */
+bool ChunkGenerator::isPending(const ChunkCoord& coord) const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return pending_.find(coord) != pending_.end();
+}
+
+/**
+ * @brief Function that returns the number of workers used by default (every core but the main one)
+ */
+std::size_t ChunkGenerator::getDefaultNumberOfWorkers()
+{
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 1;
+}
+
+/**
+ * @brief Function executed by every worker : generates the closest chunk requested
+ */
+void ChunkGenerator::work()
+{
+    Profiler::setThreadName("chunk generator");
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (true)
+    {
+        requestAvailable_.wait(lock, [this] () { return stopping_ || !requests_.empty(); });
+        if (stopping_)
+            return;
+
+        auto next = nextRequest();
+        ChunkCoord coord = *next;
+        requests_.erase(next);
+
+        // Generating the tiles outside of the lock
+        lock.unlock();
+        std::unique_ptr<Chunk> chunk = std::make_unique<Chunk>(textureSheet_, terrainGenerator_, coord, chunkSize_, tileSize_);
+        if (regionStore_)
+            regionStore_->load(*chunk);
+        lock.lock();
+
+        // The player may have moved away while the chunk was generated
+        if (getDistanceToFocus(coord) <= radius_)
+            finished_.push_back(std::move(chunk));
+        else
+            pending_.erase(coord);
+
+        requestDone_.notify_all();
+    }
+}
+
+/**
+ * @brief Function that returns the distance between a chunk and the focus
+ * @param coord         Coordinates of the chunk
+ */
+float ChunkGenerator::getDistanceToFocus(const ChunkCoord& coord) const
+{
+    return (focus_ - coord.toPosition(chunkSize_, tileSize_)).norm();
+}
+
+/**
+ * @brief Function that returns the request closest to the focus
+ * @return              Iterator to the request
+ */
+std::vector<ChunkCoord>::iterator ChunkGenerator::nextRequest()
+{
+    return std::min_element(requests_.begin(), requests_.end(), [this] (const ChunkCoord& a, const ChunkCoord& b) {
+        return getDistanceToFocus(a) < getDistanceToFocus(b);
+    });
+}
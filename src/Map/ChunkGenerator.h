@@ -0,0 +1,58 @@
+#ifndef CHUNK_GENERATOR_H
+#define CHUNK_GENERATOR_H
+
+#include "Chunk.h"
+#include "TerrainGenerator.h"
+#include "RegionStore.h"
+
+// Pool of worker threads generating chunks in the background
+class ChunkGenerator
+{
+public:
+
+    ChunkGenerator(std::shared_ptr<sf::Texture> textureSheet,
+            const TerrainGenerator& terrainGenerator,
+            RegionStore* regionStore = nullptr,
+            const Vector& chunkSize = Vector(Chunk::DEFAULT_SIZE),
+            const Vector& tileSize = Vector(TileHandler::DEFAULT_SIZE),
+            std::size_t numberOfWorkers = getDefaultNumberOfWorkers());
+    virtual ~ChunkGenerator();
+
+    void request(const ChunkCoord& coord);
+    void setFocus(const Vector& focus, float radius);
+    std::vector<std::unique_ptr<Chunk>> collect();
+    void wait();
+
+    bool isPending(const ChunkCoord& coord) const;
+
+    static std::size_t getDefaultNumberOfWorkers();
+
+private:
+
+    void work();
+    float getDistanceToFocus(const ChunkCoord& coord) const;
+    std::vector<ChunkCoord>::iterator nextRequest();
+
+    std::shared_ptr<sf::Texture> textureSheet_;
+    const TerrainGenerator& terrainGenerator_;
+    RegionStore* regionStore_;
+    Vector chunkSize_;
+    Vector tileSize_;
+
+    // Chunks requested and not collected yet (waiting or being generated)
+    std::unordered_set<ChunkCoord, ChunkCoordHasher> pending_;
+    std::vector<ChunkCoord> requests_;
+    std::vector<std::unique_ptr<Chunk>> finished_;
+
+    // Requests are generated by distance to the focus and dropped when too far from it
+    Vector focus_;
+    float radius_;
+
+    bool stopping_;
+    mutable std::mutex mutex_;
+    std::condition_variable requestAvailable_;
+    std::condition_variable requestDone_;
+    std::vector<std::thread> workers_;
+};
+
+#endif
@@ -0,0 +1,242 @@
+#include "../headers.h"
+#include "ChunkStreamer.h"
+
+const int ChunkStreamer::DEFAULT_LOAD_RADIUS = 3;
+const int ChunkStreamer::DEFAULT_UNLOAD_RADIUS = 4;
+const std::size_t ChunkStreamer::DEFAULT_CACHE_SIZE = 64;
+
+/**
+ * @brief Constructor
+ * @param chunks            Chunks loaded in the map
+ * @param generator         Generator of the missing chunks
+ * @param regionStore       Where the modified chunks are saved when dropped (null : not saved)
+ * @param chunkSize         Size of a single chunk in tiles
+ * @param tileSize          Size of a single tile in pixel
+ * @param loadRadius        Distance (in chunks) under which chunks are loaded
+ * @param unloadRadius      Distance (in chunks) over which chunks are unloaded
+ * @param cacheSize         Maximum number of unloaded chunks kept in memory
+ */
+ChunkStreamer::ChunkStreamer(ChunkMap& chunks, ChunkGenerator& generator, RegionStore* regionStore, const Vector& chunkSize, const Vector& tileSize, int loadRadius, int unloadRadius, std::size_t cacheSize)
+    :   chunks_(chunks)
+    ,   generator_(generator)
+    ,   regionStore_(regionStore)
+    ,   chunkSize_(chunkSize)
+    ,   tileSize_(tileSize)
+    ,   loadRadius_(loadRadius)
+    ,   unloadRadius_(std::max(loadRadius, unloadRadius))
+    ,   cacheSize_(cacheSize)
+    ,   hasCenter_(false)
+{
+    for (int y = -loadRadius_; y <= loadRadius_; ++y)
+    {
+        for (int x = -loadRadius_; x <= loadRadius_; ++x)
+        {
+            if (x * x + y * y <= loadRadius_ * loadRadius_)
+                offsets_.emplace_back(x, y);
+        }
+    }
+
+    std::stable_sort(offsets_.begin(), offsets_.end(), [] (const ChunkCoord& a, const ChunkCoord& b) {
+        return a.x * a.x + a.y * a.y < b.x * b.x + b.y * b.y;
+    });
+}
+
+/**
+ * @brief Destructor
+ */
+ChunkStreamer::~ChunkStreamer()
+{
+
+}
+
+/**
+ * @brief Function that loads and unloads the chunks around a position
+ * @param focus             Position of the player
+ */
+void ChunkStreamer::update(const Vector& focus)
+{
+    ChunkCoord center = ChunkCoord::fromPosition(focus, chunkSize_, tileSize_);
+
+    if (!hasCenter_ || center != center_)
+    {
+        center_ = center;
+        hasCenter_ = true;
+
+        // Requests a little farther than the unload radius are kept (distances are measured from the topleft corners)
+        float chunkLength = std::max(chunkSize_.getX() * tileSize_.getX(), chunkSize_.getY() * tileSize_.getY());
+        generator_.setFocus(center_.toPosition(chunkSize_, tileSize_), static_cast<float>(unloadRadius_) * chunkLength);
+
+        adoptChunks();
+        evictChunks();
+        requestChunks();
+    }
+    else
+    {
+        adoptChunks();
+    }
+}
+
+/**
+ * @brief Function that saves every modified chunk (loaded or cached)
+ */
+void ChunkStreamer::saveAll()
+{
+    if (!regionStore_)
+        return;
+
+    for (const auto& chunk : chunks_)
+    {
+        if (chunk.second->isModified())
+            regionStore_->save(*chunk.second);
+    }
+
+    for (const auto& chunk : cache_)
+    {
+        if (chunk->isModified())
+            regionStore_->save(*chunk);
+    }
+}
+
+/**
+ * @brief Function that returns the fraction of the chunks inside the load radius that are loaded (between 0 and 1)
+ */
+float ChunkStreamer::getLoadingProgress() const
+{
+    if (!hasCenter_)
+        return 0.0f;
+
+    std::size_t loaded = 0;
+    for (const ChunkCoord& offset : offsets_)
+    {
+        if (chunks_.find(ChunkCoord(center_.x + offset.x, center_.y + offset.y)) != chunks_.end())
+            ++loaded;
+    }
+
+    return static_cast<float>(loaded) / static_cast<float>(offsets_.size());
+}
+
+/**
+ * @brief Function that returns whether a chunk must be loaded
+ * @param coord             Coordinates of the chunk
+ */
+bool ChunkStreamer::isInLoadRadius(const ChunkCoord& coord) const
+{
+    return isInRadius(coord, loadRadius_);
+}
+
+/**
+ * @brief Function that returns whether a loaded chunk can stay loaded
+ * @param coord             Coordinates of the chunk
+ */
+bool ChunkStreamer::isInUnloadRadius(const ChunkCoord& coord) const
+{
+    return isInRadius(coord, unloadRadius_);
+}
+
+/**
+ * @brief Function that adds the chunks generated in the background to the map
+ * Chunks that are already too far away go to the cache
+ */
+void ChunkStreamer::adoptChunks()
+{
+    for (auto& chunk : generator_.collect())
+    {
+        ChunkCoord coord = chunk->getCoord();
+        if (chunks_.find(coord) != chunks_.end())
+            continue;
+
+        if (isInUnloadRadius(coord))
+            chunks_.emplace(coord, std::move(chunk));
+        else
+            cache(std::move(chunk));
+    }
+}
+
+/**
+ * @brief Function that loads every chunk inside the load radius, closest first
+ * Chunks are taken from the cache when possible, otherwise requested to the generator
+ */
+void ChunkStreamer::requestChunks()
+{
+    for (const ChunkCoord& offset : offsets_)
+    {
+        ChunkCoord coord(center_.x + offset.x, center_.y + offset.y);
+        if (chunks_.find(coord) != chunks_.end())
+            continue;
+
+        std::unique_ptr<Chunk> chunk = takeFromCache(coord);
+        if (chunk)
+            chunks_.emplace(coord, std::move(chunk));
+        else
+            generator_.request(coord);
+    }
+}
+
+/**
+ * @brief Function that moves the chunks outside the unload radius to the cache
+ */
+void ChunkStreamer::evictChunks()
+{
+    for (auto it = chunks_.begin(); it != chunks_.end();)
+    {
+        if (isInUnloadRadius(it->first))
+        {
+            ++it;
+            continue;
+        }
+
+        cache(std::move(it->second));
+        it = chunks_.erase(it);
+    }
+}
+
+/**
+ * @brief Function that adds a chunk to the cache
+ * The least recently evicted chunk is dropped (and saved if modified) when the cache is full
+ * @param chunk             Chunk unloaded
+ */
+void ChunkStreamer::cache(std::unique_ptr<Chunk> chunk)
+{
+    ChunkCoord coord = chunk->getCoord();
+    cache_.push_front(std::move(chunk));
+    cacheIndex_[coord] = cache_.begin();
+
+    while (cache_.size() > cacheSize_)
+    {
+        const std::unique_ptr<Chunk>& oldest = cache_.back();
+        if (regionStore_ && oldest->isModified())
+            regionStore_->save(*oldest);
+
+        cacheIndex_.erase(oldest->getCoord());
+        cache_.pop_back();
+    }
+}
+
+/**
+ * @brief Function that removes a chunk from the cache
+ * @param coord             Coordinates of the chunk
+ * @return                  Chunk cached (nullptr if not in the cache)
+ */
+std::unique_ptr<Chunk> ChunkStreamer::takeFromCache(const ChunkCoord& coord)
+{
+    const auto& entry = cacheIndex_.find(coord);
+    if (entry == cacheIndex_.end())
+        return nullptr;
+
+    std::unique_ptr<Chunk> chunk = std::move(*entry->second);
+    cache_.erase(entry->second);
+    cacheIndex_.erase(entry);
+    return chunk;
+}
+
+/**
+ * @brief Function that returns whether a chunk is inside a radius around the center
+ * @param coord             Coordinates of the chunk
+ * @param radius            Radius in chunks
+ */
+bool ChunkStreamer::isInRadius(const ChunkCoord& coord, int radius) const
+{
+    int dx = coord.x - center_.x;
+    int dy = coord.y - center_.y;
+    return dx * dx + dy * dy <= radius * radius;
+}
@@ -0,0 +1,69 @@
+#ifndef CHUNK_STREAMER_H
+#define CHUNK_STREAMER_H
+
+#include "Chunk.h"
+#include "ChunkGenerator.h"
+#include "RegionStore.h"
+
+// Decides which chunks are loaded around the player
+// Chunks are loaded inside the load radius and unloaded outside the unload radius (hysteresis),
+// unloaded chunks are kept in a bounded LRU cache before being dropped (and saved if modified)
+class ChunkStreamer
+{
+public:
+
+    typedef std::unordered_map<ChunkCoord, std::unique_ptr<Chunk>, ChunkCoordHasher> ChunkMap;
+
+    static const int DEFAULT_LOAD_RADIUS;
+    static const int DEFAULT_UNLOAD_RADIUS;
+    static const std::size_t DEFAULT_CACHE_SIZE;
+
+    ChunkStreamer(ChunkMap& chunks, ChunkGenerator& generator, RegionStore* regionStore,
+            const Vector& chunkSize = Vector(Chunk::DEFAULT_SIZE),
+            const Vector& tileSize = Vector(TileHandler::DEFAULT_SIZE),
+            int loadRadius = DEFAULT_LOAD_RADIUS,
+            int unloadRadius = DEFAULT_UNLOAD_RADIUS,
+            std::size_t cacheSize = DEFAULT_CACHE_SIZE);
+    virtual ~ChunkStreamer();
+
+    void update(const Vector& focus);
+    void saveAll();
+
+    float getLoadingProgress() const;
+
+    bool isInLoadRadius(const ChunkCoord& coord) const;
+    bool isInUnloadRadius(const ChunkCoord& coord) const;
+
+private:
+
+    void adoptChunks();
+    void requestChunks();
+    void evictChunks();
+
+    void cache(std::unique_ptr<Chunk> chunk);
+    std::unique_ptr<Chunk> takeFromCache(const ChunkCoord& coord);
+    bool isInRadius(const ChunkCoord& coord, int radius) const;
+
+    ChunkMap& chunks_;
+    ChunkGenerator& generator_;
+    RegionStore* regionStore_;
+    Vector chunkSize_;
+    Vector tileSize_;
+
+    int loadRadius_;
+    int unloadRadius_;
+    std::size_t cacheSize_;
+
+    // Chunk containing the focus (the required chunks are only recomputed when it changes)
+    ChunkCoord center_;
+    bool hasCenter_;
+
+    // Offsets of the chunks inside the load radius, sorted by distance to the center
+    std::vector<ChunkCoord> offsets_;
+
+    // Most recently evicted chunks first
+    std::list<std::unique_ptr<Chunk>> cache_;
+    std::unordered_map<ChunkCoord, std::list<std::unique_ptr<Chunk>>::iterator, ChunkCoordHasher> cacheIndex_;
+};
+
+#endif
@@ -21,16 +21,16 @@ CollisionHandler& CollisionHandler::getInstance()
 
 /**
  * @brief Function that collides to objects
- * @param hitbox        Hitbox component
+ * @param rect          Rectangle of the object pushed
  * @param collider      Collider
- * @return              Offset to applX to the hitbox
+ * @return              Offset to applX to the rectangle
  */
-Vector CollisionHandler::I_collide(const HitboxComponent& hitbox, const sf::FloatRect& collider)
+Vector CollisionHandler::I_collide(const sf::FloatRect& rect, const sf::FloatRect& collider)
 {
     Vector dp;
-    Vector hitboxPosition = Vector(hitbox.getHitbox().left, hitbox.getHitbox().top);
+    Vector hitboxPosition = Vector(rect.left, rect.top);
     Vector colliderPosition = Vector(collider.left, collider.top);
-    Vector hitboxSize = Vector(hitbox.getHitbox().width, hitbox.getHitbox().height);
+    Vector hitboxSize = Vector(rect.width, rect.height);
     Vector colliderSize = Vector(collider.width, collider.height);
 
     if (hitboxPosition.getY() > colliderPosition.getY())
@@ -54,3 +54,63 @@ Vector CollisionHandler::I_collide(const HitboxComponent& hitbox, const sf::Floa
     return Vector(0.0f, dp.getY());
 
 }
+
+/**
+ * @brief Function that sweeps a rectangle along a movement against a collider (time of impact)
+ * A rectangle already overlapping the collider at the start is not a contact (see collide)
+ * @param rect          Rectangle of the object moving (at the start of the movement)
+ * @param movement      Movement of the object during the step
+ * @param collider      Collider
+ * @return              Contact (first time the faces touch and normal of the face touched)
+ */
+Contact CollisionHandler::I_sweep(const sf::FloatRect& rect, const Vector& movement, const sf::FloatRect& collider)
+{
+    Contact none { false, 1.0f, Vector(0.0f, 0.0f) };
+
+    // Times at which the rectangle enters and exits the collider on each axis
+    float entryX, exitX, entryY, exitY;
+    const float infinity = std::numeric_limits<float>::infinity();
+
+    if (movement.getX() == 0)
+    {
+        if (rect.left + rect.width <= collider.left || rect.left >= collider.left + collider.width)
+            return none;
+        entryX = -infinity;
+        exitX = infinity;
+    } else
+    {
+        entryX = ((movement.getX() > 0 ? collider.left - rect.width : collider.left + collider.width) - rect.left) / movement.getX();
+        exitX = ((movement.getX() > 0 ? collider.left + collider.width : collider.left - rect.width) - rect.left) / movement.getX();
+    }
+
+    if (movement.getY() == 0)
+    {
+        if (rect.top + rect.height <= collider.top || rect.top >= collider.top + collider.height)
+            return none;
+        entryY = -infinity;
+        exitY = infinity;
+    } else
+    {
+        entryY = ((movement.getY() > 0 ? collider.top - rect.height : collider.top + collider.height) - rect.top) / movement.getY();
+        exitY = ((movement.getY() > 0 ? collider.top + collider.height : collider.top - rect.height) - rect.top) / movement.getY();
+    }
+
+    float entry = std::max(entryX, entryY);
+    float leave = std::min(exitX, exitY);
+
+    if (entry >= leave || entry > 1.0f)
+        return none;
+
+    // Rectangle resting against the collider, a little inside because of rounding errors : contact right away
+    float depth = -entry * std::abs(entry == entryX ? movement.getX() : movement.getY());
+    if (entry < 0.0f && !(depth <= CONTACT_TOLERANCE))
+        return none;
+
+    Contact contact { true, std::max(entry, 0.0f), Vector(0.0f, 0.0f) };
+    if (entryX == entry)
+        contact.normal.setX(movement.getX() > 0 ? -1.0f : 1.0f);
+    if (entryY == entry)
+        contact.normal.setY(movement.getY() > 0 ? -1.0f : 1.0f);
+
+    return contact;
+}
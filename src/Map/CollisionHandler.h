@@ -4,12 +4,22 @@
 #include "../Math/Vector.h"
 #include "../Entities/HitboxComponent.h"
 
+// Result of a swept collision
+struct Contact
+{
+    bool hit;           // Whether the rectangle touches the collider during the movement
+    float time;         // Fraction of the movement done before the contact (in [0, 1])
+    Vector normal;      // Normal of the face touched (both components set when a corner is hit exactly)
+};
+
 // Singleton class
 class CollisionHandler
 {
 
 public:
 
+    static constexpr float CONTACT_TOLERANCE = 0.01f;      // Depth under which a rectangle is still touching a collider
+
     CollisionHandler(const CollisionHandler&) = delete;
     void operator=(const CollisionHandler&) = delete;
 
@@ -17,12 +27,23 @@ public:
 
     static Vector collide(const HitboxComponent& hitbox, const sf::FloatRect& collider)
     {
-        return getInstance().I_collide(hitbox, collider);
+        return getInstance().I_collide(hitbox.getHitbox(), collider);
+    }
+
+    static Vector collide(const sf::FloatRect& rect, const sf::FloatRect& collider)
+    {
+        return getInstance().I_collide(rect, collider);
+    }
+
+    static Contact sweep(const sf::FloatRect& rect, const Vector& movement, const sf::FloatRect& collider)
+    {
+        return getInstance().I_sweep(rect, movement, collider);
     }
 
 private:
 
-    Vector I_collide(const HitboxComponent& hitbox, const sf::FloatRect& collider);
+    Vector I_collide(const sf::FloatRect& rect, const sf::FloatRect& collider);
+    Contact I_sweep(const sf::FloatRect& rect, const Vector& movement, const sf::FloatRect& collider);
     CollisionHandler();
 
 };
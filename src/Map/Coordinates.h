@@ -0,0 +1,86 @@
+#ifndef COORDINATES_H
+#define COORDINATES_H
+
+#include "../Math/Vector.h"
+
+/**
+ * @brief Division rounding towards negative infinity (-1 / 16 = -1)
+ */
+inline int floorDivide(int a, int b)
+{
+    return a >= 0 ? a / b : -((-a + b - 1) / b);
+}
+
+// Integer position of a tile (in tiles, global or local to a chunk)
+struct TileCoord
+{
+    int x = 0;
+    int y = 0;
+
+    TileCoord() = default;
+    TileCoord(int X, int Y) : x(X), y(Y) {}
+
+    static TileCoord fromPosition(const Vector& position, const Vector& tileSize)
+    {
+        return TileCoord(
+            static_cast<int>(std::floor(position.getX() / tileSize.getX())),
+            static_cast<int>(std::floor(position.getY() / tileSize.getY()))
+        );
+    }
+
+    Vector toPosition(const Vector& tileSize) const
+        { return Vector(static_cast<float>(x) * tileSize.getX(), static_cast<float>(y) * tileSize.getY()); }
+
+    bool operator==(const TileCoord& c) const
+        { return x == c.x && y == c.y; }
+
+    bool operator!=(const TileCoord& c) const
+        { return !(*this == c); }
+};
+
+// Integer position of a chunk (in chunks)
+struct ChunkCoord
+{
+    int x = 0;
+    int y = 0;
+
+    ChunkCoord() = default;
+    ChunkCoord(int X, int Y) : x(X), y(Y) {}
+
+    static ChunkCoord fromTile(const TileCoord& tile, int chunkWidth, int chunkHeight)
+        { return ChunkCoord(floorDivide(tile.x, chunkWidth), floorDivide(tile.y, chunkHeight)); }
+
+    static ChunkCoord fromPosition(const Vector& position, const Vector& chunkSize, const Vector& tileSize)
+    {
+        return ChunkCoord(
+            static_cast<int>(std::floor(position.getX() / (chunkSize.getX() * tileSize.getX()))),
+            static_cast<int>(std::floor(position.getY() / (chunkSize.getY() * tileSize.getY())))
+        );
+    }
+
+    Vector toPosition(const Vector& chunkSize, const Vector& tileSize) const
+    {
+        return Vector(
+            static_cast<float>(x) * chunkSize.getX() * tileSize.getX(),
+            static_cast<float>(y) * chunkSize.getY() * tileSize.getY()
+        );
+    }
+
+    bool operator==(const ChunkCoord& c) const
+        { return x == c.x && y == c.y; }
+
+    bool operator!=(const ChunkCoord& c) const
+        { return !(*this == c); }
+};
+
+class ChunkCoordHasher
+{
+public:
+    std::size_t operator()(const ChunkCoord& c) const
+    {
+        std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(c.x)) << 32) | static_cast<std::uint32_t>(c.y);
+        return std::hash<std::uint64_t>()(key);
+    }
+};
+
+#endif
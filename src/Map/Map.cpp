@@ -1,50 +1,64 @@
 #include "../headers.h"
 #include "Map.h"
+#include "../Render/ResourceCache.h"
+#include "../Profiling/Profiler.h"
 
-const float Map::CHUNK_RADIUS = 2.0f;
+#include <filesystem>
+
+const std::string Map::SAVE_DIRECTORY = "saves";
+const std::string Map::WORLD_CONFIG = Map::SAVE_DIRECTORY + "/world.ini";
+const std::string Map::SPRITE_SHEET = "resources/game/map/sprite_sheet_mbm.png";
 
 /**
  * @brief Constructor
  * @param view          View of the player
  * @param player        Player
  * @param center        Center of the map (coordinates of the topleft of the center chunk)
+ * @param seed          Seed of the terrain
+ * @param textured      Whether the chunks have a texture (false : simulation only, no window)
+ * @param saved         Whether the chunks modified are saved (false : the same seed always gives the same map)
  * @param chunkSize     Size of a single chunk in tiles
  * @param tileSize      Size of a single tile in pixel
  */
-Map::Map(const sf::View& view, Player& player, const Vector& center, const Vector& chunkSize, const Vector& tileSize)
+Map::Map(const sf::View& view, Player& player, const Vector& center, int seed, bool textured, bool saved, const Vector& chunkSize, const Vector& tileSize)
     :   view_(view)
     ,   player_(player)
     ,   center_(center)
     ,   chunkSize_(chunkSize)
     ,   tileSize_(tileSize)
-    ,   terrainGenerator_(rand())
+    ,   terrainGenerator_(seed)
 {
 
-    loadTextures();
+    if (textured)
+        loadTextures();
+
+    if (saved)
+        regionStore_ = std::make_unique<RegionStore>(SAVE_DIRECTORY + "/world_" + std::to_string(seed), seed);
+
+    chunkGenerator_ = std::make_unique<ChunkGenerator>(textures_["MAP"], terrainGenerator_, regionStore_.get(), chunkSize_, tileSize_);
+    chunkStreamer_ = std::make_unique<ChunkStreamer>(chunks_, *chunkGenerator_, regionStore_.get(), chunkSize_, tileSize_);
 
-    chunks_.emplace(center, std::make_unique<Chunk>(textures_["MAP"], terrainGenerator_, center, chunkSize_, tileSize_));
-    centerChunk_ = chunks_.at(center).get();
-    generateChunks();
-    generateChunks();
-    generateChunks();
+    // The area around the player is generated in the background (see getLoadingProgress and waitForLoading)
+    chunkStreamer_->update(player_.getPosition());
 }
 
 /**
- * @brief Destructor
+ * @brief Destructor (saves the chunks modified by the player)
  */
 Map::~Map()
 {
-
+    chunkStreamer_->saveAll();
 }
 
 /**
- * @brief Function that updates the tile
+ * @brief Function that updates the tiles around the player (the chunks are loaded by updateChunks)
  * @param dt            Time since last frame
  */
 void Map::update(const float& dt)
 {
-    collide();
-    updateChunks();
+    ProfileZone zone("Map::update");
+
+    trample();
     for (const auto& chunk : chunks_)
     {
         chunk.second->update(dt);
@@ -55,8 +69,10 @@ void Map::update(const float& dt)
  * @brief Function that renders the tilea on top
  * @param target        Where to draw the tile
  */
-void Map::render(std::shared_ptr<sf::RenderTarget> target)
+void Map::render(std::shared_ptr<RenderSnapshot> target)
 {
+    ProfileZone zone("Map::render");
+    target->beginSection("map");
 
     for (const auto& chunk : chunks_)
     {
@@ -71,8 +87,9 @@ void Map::render(std::shared_ptr<sf::RenderTarget> target)
  * @brief Function that renders the tiles on top
  * @param target        Where to draw the tile
  */
-void Map::renderOnTop(std::shared_ptr<sf::RenderTarget> target)
+void Map::renderOnTop(std::shared_ptr<RenderSnapshot> target)
 {
+    target->beginSection("map on top");
 
     for (const auto& chunk : chunks_)
     {
@@ -89,22 +106,32 @@ void Map::renderOnTop(std::shared_ptr<sf::RenderTarget> target)
  */
 void Map::loadTextures()
 {
-    sf::Texture texture;
+    textures_["MAP"] = ResourceCache::getTexture(SPRITE_SHEET);
+}
 
-    // Player texture
-    if (!texture.loadFromFile("resources/game/map/sprite_sheet_mbm.png"))
-        throw("Error : Could not load player's sprite sheet texture");
+/**
+ * @brief Function that loads and unloads the chunks around the player
+ */
+void Map::updateChunks()
+{
+    chunkStreamer_->update(player_.getPosition());
+}
 
-    textures_["MAP"] = std::make_shared<sf::Texture>(texture);
+/**
+ * @brief Function that waits until the chunks around the player are generated
+ */
+void Map::waitForLoading()
+{
+    chunkGenerator_->wait();
+    updateChunks();
 }
 
 /**
- * @brief Function that updates the chunks
+ * @brief Function that returns the fraction of the chunks around the player that are loaded (between 0 and 1)
  */
-void Map::updateChunks()
+float Map::getLoadingProgress() const
 {
-    generateChunks();
-    removeChunks();
+    return chunkStreamer_->getLoadingProgress();
 }
 
 /**
@@ -112,14 +139,14 @@ void Map::updateChunks()
  * @param position          Position of the tile
  * @return                  Tile
  */
-const std::string& Map::getTile(const Vector& globalPosition) const
+TileID Map::getTile(const Vector& globalPosition) const
 {
-    Vector position(
-        static_cast<int>(globalPosition.getX()) % static_cast<int>(chunkSize_.getX() * tileSize_.getX()),
-        static_cast<int>(globalPosition.getY()) % static_cast<int>(chunkSize_.getY() * tileSize_.getY())
-    );
+    TileCoord tile = TileCoord::fromPosition(globalPosition, tileSize_);
+    int width = static_cast<int>(chunkSize_.getX());
+    int height = static_cast<int>(chunkSize_.getY());
+    ChunkCoord coord = ChunkCoord::fromTile(tile, width, height);
 
-    return chunks_.at(position)->getTile(globalPosition);
+    return chunks_.at(coord)->getTile(TileCoord(tile.x - coord.x * width, tile.y - coord.y * height));
 }
 
 /**
@@ -137,137 +164,230 @@ sf::FloatRect Map::getViewRect() const
 }
 
 /**
- * @brief Function that collides the player with the map
+ * @brief Function that returns the coordinates of the chunk containing a position
+ * @param globalPosition    Position in the world
+ * @return                  Chunk's coordinates
  */
-void Map::collide()
+ChunkCoord Map::getChunkCoord(const Vector& globalPosition) const
 {
-    const HitboxComponent& hitbox = player_.getHitbox();
-    std::unordered_set<const Chunk*> chunks = chunksColliding(hitbox);
+    return ChunkCoord::fromPosition(globalPosition, chunkSize_, tileSize_);
+}
 
-    for (const Chunk* c : chunks)
-    {
-        Chunk* chunk = const_cast<Chunk*>(c);
-        std::vector<Vector> offsets = chunk->collide(hitbox);
-        
-        for (const Vector& offset : offsets) 
-        {
-            player_.applyForce(offset);
-        }
+/**
+ * @brief Function that returns the position of the topleft corner of a chunk
+ * @param coord             Chunk's coordinates
+ * @return                  Chunk's position
+ */
+Vector Map::getChunkPosition(const ChunkCoord& coord) const
+{
+    return coord.toPosition(chunkSize_, tileSize_);
+}
 
-    }
+/**
+ * @brief Function that returns the number of chunks loaded
+ */
+std::size_t Map::getNumberOfChunks() const
+{
+    return chunks_.size();
 }
 
 /**
- * @brief Function that returns a map of every chunk colliding with a rectangle
- * @param hibox             Rectangle
- * Could be improved by only calling this function when the player moves
+ * @brief Function that returns the seed of the terrain
  */
-std::unordered_set<const Chunk*> Map::chunksColliding(const HitboxComponent& hitbox)
+int Map::getSeed() const
 {
-    // Getting the corners of the hitbox
-    std::array<Vector, 4> positions = Vector::getCorners(hitbox.getHitbox());
+    return terrainGenerator_.getSeed();
+}
 
-    // Getting the position of the chunk
-    for (Vector& v : positions)
-    {
-        v = Vector(
-            (chunkSize_.getX() * tileSize_.getX()) * static_cast<float>(floor(v.getX() / (chunkSize_.getX() * tileSize_.getX()))),
-            (chunkSize_.getY() * tileSize_.getY()) * static_cast<float>(floor(v.getY() / (chunkSize_.getY() * tileSize_.getY())))
-        );
-    }
+/**
+ * @brief Function that creates a random seed for a new map (positive)
+ */
+int Map::createSeed()
+{
+    return static_cast<int>(Random::createSeed() & 0x7FFFFFFF);
+}
+
+/**
+ * @brief Function that returns the seed of the saved world (a new world is created the first time)
+ * Format : seed value
+ */
+int Map::loadSeed()
+{
+    std::ifstream file(WORLD_CONFIG);
+    std::string key;
+    int seed = 0;
 
+    if (file >> key >> seed && key == "seed")
+        return seed;
 
-    // Getting the chunks colliding
-    std::unordered_set<const Chunk*> chunksColliding;
-    std::for_each(positions.begin(), positions.end(), [&] (const Vector& pos) {
-        const auto& chunk = chunks_.find(pos);
+    // The chunks saved are only valid for this seed : it is kept for the next launches
+    seed = createSeed();
 
-        if (chunk != chunks_.end() &&
-            hitbox.isIntersecting(chunk->second->getRectangle()))
-            {
-                chunksColliding.emplace(chunk->second.get());
-            }
-    });
+    std::error_code error;
+    std::filesystem::create_directories(SAVE_DIRECTORY, error);
+    std::ofstream config(WORLD_CONFIG);
+    if (!(config << "seed " << seed << "\n"))
+        std::cout << "Error : Could not write " << WORLD_CONFIG << "\n";
 
-    return chunksColliding;
+    return seed;
 }
 
-
 /**
- * @brief Function that generates the chunks around the player
- * @param playerPosition    Position of the player
+ * @brief Function that collides movable entities with the terrain (one pass over every entity)
+ * Each body is swept along its movement and stops (or slides) on the first solid blocks it meets,
+ * then is pushed out of the blocks it still overlaps
+ * The result does not depend on the order of the blocks : contacts at the same time are applied together
+ * @param bodies        Entities (contiguous)
+ * @param count         Number of entities
  */
-void Map::generateChunks()
+void Map::collide(TerrainBody* bodies, std::size_t count) const
 {
-    std::vector<Vector> currentPositions;
-    for (const auto& i : chunks_)
-        currentPositions.push_back(i.first);
+    // Buffer shared by every body : allocated once per pass, grows when a movement touches more blocks
+    std::vector<sf::FloatRect> blocks;
+    blocks.reserve(SWEPT_BLOCKS_RESERVED);
 
-    for (const auto& position : currentPositions)
+    for (TerrainBody* body = bodies; body != bodies + count; ++body)
     {
-        std::vector<Vector> positions;
-        
-        // Left
-        positions.push_back(position - Vector(chunkSize_.getX() * tileSize_.getX(), 0.0f));
-        
-        // Right
-        positions.push_back(position + Vector(chunkSize_.getX() * tileSize_.getX(), 0.0f));
-        
-        // Top
-        positions.push_back(position - Vector(0.0f, chunkSize_.getY() * tileSize_.getY()));
-        
-        // Bottom
-        positions.push_back(position + Vector(0.0f, chunkSize_.getY() * tileSize_.getY()));
-
-        for (const Vector& pos : positions)
+        std::fill(std::begin(body->blocked), std::end(body->blocked), false);
+
+        // Every block the hitbox can touch during the movement
+        sf::FloatRect rect(body->aabb.left - body->movement.getX(), body->aabb.top - body->movement.getY(), body->aabb.width, body->aabb.height);
+        sf::FloatRect swept(std::min(rect.left, body->aabb.left), std::min(rect.top, body->aabb.top),
+                body->aabb.width + std::abs(body->movement.getX()), body->aabb.height + std::abs(body->movement.getY()));
+        queryBlocks(swept, blocks);
+        std::size_t numberOfBlocks = blocks.size();
+
+        // Sweep : move until the earliest contact, cancel the movement along its normal and slide with the rest
+        Vector movement = body->movement;
+        for (int iteration = 0; iteration < MAX_SWEEP_ITERATIONS && !(movement == Vector(0.0f, 0.0f)); ++iteration)
         {
-            if (!isChunkGenerated(pos) && (player_.getPosition() - pos).norm() < CHUNK_RADIUS * chunkSize_.norm() * tileSize_.norm())
+            Contact earliest { false, 1.0f, Vector(0.0f, 0.0f) };
+            for (std::size_t i = 0; i < numberOfBlocks; ++i)
+            {
+                Contact contact = CollisionHandler::sweep(rect, movement, blocks[i]);
+                if (!contact.hit || contact.time > earliest.time)
+                    continue;
+
+                if (!earliest.hit || contact.time < earliest.time)
+                {
+                    earliest = contact;
+                } else
+                {
+                    // Same time : every face touched blocks the movement
+                    if (contact.normal.getX() != 0)
+                        earliest.normal.setX(contact.normal.getX());
+                    if (contact.normal.getY() != 0)
+                        earliest.normal.setY(contact.normal.getY());
+                }
+            }
+
+            rect.left += movement.getX() * earliest.time;
+            rect.top += movement.getY() * earliest.time;
+            if (!earliest.hit)
+                break;
+
+            movement = movement * (1.0f - earliest.time);
+            if (earliest.normal.getX() != 0)
             {
-                // Chunk must be added
-                generateChunk(pos);
+                body->blocked[earliest.normal.getX() > 0 ? LEFT : RIGHT] = true;
+                body->velocity.setX(0);
+                movement.setX(0);
+            }
+            if (earliest.normal.getY() != 0)
+            {
+                body->blocked[earliest.normal.getY() > 0 ? UP : DOWN] = true;
+                body->velocity.setY(0);
+                movement.setY(0);
             }
         }
 
-    }
+        body->offset = Vector(rect.left - body->aabb.left, rect.top - body->aabb.top);
 
-}
+        // Push out of the blocks still overlapped (entity spawned inside a block, rounding errors)
+        for (std::size_t i = 0; i < numberOfBlocks; ++i)
+        {
+            if (!rect.intersects(blocks[i]))
+                continue;
 
+            Vector offset = CollisionHandler::collide(rect, blocks[i]);
+            body->offset += offset;
+
+            if (offset.getX() > 0)
+                body->blocked[LEFT] = true;
+            else if (offset.getX() < 0)
+                body->blocked[RIGHT] = true;
+
+            if (offset.getY() > 0)
+                body->blocked[UP] = true;
+            else if (offset.getY() < 0)
+                body->blocked[DOWN] = true;
+
+            if (offset.getX() != 0)
+                body->velocity.setX(0);
+
+            if (offset.getY() != 0)
+                body->velocity.setY(0);
+        }
+    }
+}
 
 /**
- * @brief Function that generates a chunk at a certain position using perlin noise
- * @param position      Position where to generate chunk
+ * @brief Function that removes the bushes the player walks on
  */
-void Map::generateChunk(const Vector& position)
+void Map::trample()
 {
-    chunks_.emplace(position, std::make_unique<Chunk>(textures_["MAP"], terrainGenerator_, position, chunkSize_, tileSize_));
+    sf::FloatRect hitbox = player_.getHitbox().getHitbox();
+    std::array<Chunk*, 4> chunks;
+    std::size_t numberOfChunks = chunksColliding(hitbox, chunks);
+
+    for (std::size_t i = 0; i < numberOfChunks; ++i)
+    {
+        chunks[i]->trample(hitbox);
+    }
 }
 
 /**
- * @brief Function that returns whether a chunk was already generated at a certain position
- * @param position      Position to look for chunk
- * @return              Chunk already generated or not
+ * @brief Function that returns every chunk colliding with a rectangle
+ * @param area              Rectangle
+ * @param chunks            Chunks colliding (each chunk once)
+ * @return                  Number of chunks colliding
  */
-bool Map::isChunkGenerated(const Vector& position) const
+std::size_t Map::chunksColliding(const sf::FloatRect& area, std::array<Chunk*, 4>& chunks) const
 {
-    return chunks_.find(position) != chunks_.end();
+    // Getting the corners of the rectangle
+    std::array<Vector, 4> positions = Vector::getCorners(area);
+
+    // Getting the chunks colliding
+    std::size_t count = 0;
+    for (const Vector& pos : positions)
+    {
+        const auto& chunk = chunks_.find(getChunkCoord(pos));
+
+        if (chunk != chunks_.end() &&
+            area.intersects(chunk->second->getRectangle()) &&
+            std::find(chunks.begin(), chunks.begin() + count, chunk->second.get()) == chunks.begin() + count)
+            {
+                chunks[count++] = chunk->second.get();
+            }
+    }
+
+    return count;
 }
 
 /**
- * @brief Function that removes the chunks too far away
- * @param playerPosition    Position of the player
+ * @brief Function that returns the solid blocks intersecting a rectangle (every chunk)
+ * @param area              Rectangle
+ * @param blocks            Blocks found (each block once, previous content removed)
  */
-void Map::removeChunks()
+void Map::queryBlocks(const sf::FloatRect& area, std::vector<sf::FloatRect>& blocks) const
 {
-    std::vector<Vector> deletedChunks;
-    for (const auto& chunk : chunks_)
+    // Colliders can stick out of their chunk (trunks of the trees)
+    std::array<Chunk*, 4> chunks;
+    std::size_t numberOfChunks = chunksColliding(Chunk::getColliderSearchArea(area, tileSize_), chunks);
+
+    blocks.clear();
+    for (std::size_t i = 0; i < numberOfChunks; ++i)
     {
-        if ((player_.getPosition() - chunk.first).norm() > CHUNK_RADIUS * chunkSize_.norm() * tileSize_.norm())
-        {
-            deletedChunks.push_back(chunk.first);
-        }
+        chunks[i]->queryBlocks(area, blocks);
     }
-
-    for (const auto& c : deletedChunks)
-        chunks_.erase(c);
 }
-
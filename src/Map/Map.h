@@ -7,6 +7,10 @@
 
 #include "Chunk.h"
 #include "TerrainGenerator.h"
+#include "ChunkGenerator.h"
+#include "RegionStore.h"
+#include "ChunkStreamer.h"
+#include "TerrainBody.h"
 
 class Map
     :   public Drawable
@@ -14,33 +18,46 @@ class Map
 
 public:
 
-    static const float CHUNK_RADIUS;
+    static const std::string SAVE_DIRECTORY;
+    static const std::string WORLD_CONFIG;
+    static const std::string SPRITE_SHEET;
+    static constexpr std::size_t SWEPT_BLOCKS_RESERVED = 64;                    // Blocks near the movement of an entity (grows if needed)
+    static constexpr int MAX_SWEEP_ITERATIONS = 3;                              // Contacts resolved in one step
 
     Map(const sf::View& view, Player& player,
         const Vector& center,
+        int seed = loadSeed(),
+        bool textured = true,
+        bool saved = true,
         const Vector& chunkSize = Vector(Chunk::DEFAULT_SIZE),
         const Vector& tileSize = Vector(TileHandler::DEFAULT_SIZE));
     virtual ~Map();
 
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
-    virtual void renderOnTop(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
+    virtual void renderOnTop(std::shared_ptr<RenderSnapshot> target = nullptr);
     virtual void loadTextures();
 
     void updateChunks();
+    void waitForLoading();
+    float getLoadingProgress() const;
+    void collide(TerrainBody* bodies, std::size_t count) const;
 
-    const std::string& getTile(const Vector& globalPosition) const;
+    TileID getTile(const Vector& globalPosition) const;
     sf::FloatRect getViewRect() const;
+    ChunkCoord getChunkCoord(const Vector& globalPosition) const;
+    Vector getChunkPosition(const ChunkCoord& coord) const;
+    std::size_t getNumberOfChunks() const;
+    int getSeed() const;
 
-private:
+    static int createSeed();
+    static int loadSeed();
 
-    void collide();
-    std::unordered_set<const Chunk*> chunksColliding(const HitboxComponent& hitbox);
-    void generateChunks();
-    void generateChunk(const Vector& position);
-    bool isChunkGenerated(const Vector& position) const;
+private:
 
-    void removeChunks();
+    void trample();
+    std::size_t chunksColliding(const sf::FloatRect& area, std::array<Chunk*, 4>& chunks) const;
+    void queryBlocks(const sf::FloatRect& area, std::vector<sf::FloatRect>& blocks) const;
 
     const sf::View& view_;
     Player& player_;
@@ -48,12 +65,16 @@ private:
     Vector chunkSize_;
     Vector tileSize_;
 
-    const Chunk* centerChunk_;
-    std::unordered_map<Vector, std::unique_ptr<Chunk>, VectorHasher> chunks_;
+    ChunkStreamer::ChunkMap chunks_;
 
     std::unordered_map<std::string, std::shared_ptr<sf::Texture>> textures_;
 
     TerrainGenerator terrainGenerator_;
+    std::unique_ptr<RegionStore> regionStore_;     // Null when not saved
+
+    // Declared after the terrain generator : workers must stop before it is destroyed
+    std::unique_ptr<ChunkGenerator> chunkGenerator_;
+    std::unique_ptr<ChunkStreamer> chunkStreamer_;
 
 };
 
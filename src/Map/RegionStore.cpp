@@ -0,0 +1,321 @@
+#include "../headers.h"
+#include "RegionStore.h"
+
+#include <filesystem>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Layout of a region file : header, table of REGION_SIZE * REGION_SIZE entries, chunk records
+static constexpr std::uint32_t REGION_MAGIC = 0x47525349;   // "ISRG"
+static constexpr std::uint32_t REGION_VERSION = 2;       // Header : magic, version, seed, hash of the tile registry
+static constexpr std::size_t REGION_HEADER_SIZE = 4 * sizeof(std::uint32_t);
+static constexpr std::size_t REGION_SLOTS = RegionStore::REGION_SIZE * RegionStore::REGION_SIZE;
+static constexpr std::size_t REGION_DATA_START = REGION_HEADER_SIZE + REGION_SLOTS * 2 * sizeof(std::uint32_t);
+
+/**
+ * @brief Constructor
+ * @param directory     Directory of the region files
+ * @param seed          Seed of the terrain (changes are only valid for the terrain they were made on)
+ */
+RegionStore::RegionStore(const std::string& directory, int seed)
+    :   directory_(directory)
+    ,   directoryCreated_(false)
+    ,   seed_(seed)
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+RegionStore::~RegionStore()
+{
+    for (auto& region : regions_)
+    {
+        closeRegion(region.second);
+    }
+}
+
+/**
+ * @brief Function that saves the changes made to a chunk
+ * Record format : number of changes, then (index, layer, tile) for each change
+ * @param chunk         Chunk to save
+ */
+void RegionStore::save(const Chunk& chunk)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const ChunkCoord& coord = chunk.getCoord();
+    ChunkCoord regionCoord = getRegionCoord(coord);
+    std::size_t slot = getSlot(coord);
+
+    const std::vector<TileChange>& changes = chunk.getChanges();
+    Region* region = getRegion(regionCoord, !changes.empty());
+    if (!region)
+        return;
+
+    if (changes.empty())
+    {
+        // Chunk is identical to the generated one again
+        writeEntry(*region, slot, TableEntry { 0, 0 });
+        return;
+    }
+
+    std::vector<std::uint16_t> record;
+    record.reserve(2 + 3 * changes.size());
+    record.push_back(static_cast<std::uint16_t>(changes.size() & 0xFFFF));
+    record.push_back(static_cast<std::uint16_t>(changes.size() >> 16));
+    for (const TileChange& change : changes)
+    {
+        record.push_back(change.index);
+        record.push_back(static_cast<std::uint16_t>(change.layer));
+        record.push_back(change.tile);
+    }
+
+    // Record is written in place if it fits, at the end of the file otherwise
+    // End taken from the file : the mapping can be missing (mmap failed) and would overwrite the table
+    std::size_t length = record.size() * sizeof(std::uint16_t);
+    TableEntry entry = readEntry(*region, slot);
+    if (entry.offset == 0 || length > entry.length)
+    {
+        off_t end = lseek(region->file, 0, SEEK_END);
+        if (end < static_cast<off_t>(REGION_DATA_START))
+        {
+            std::cout << "Error : Could not save chunk " << coord.x << ", " << coord.y << "\n";
+            return;
+        }
+        entry.offset = static_cast<std::uint32_t>(end);
+    }
+    entry.length = static_cast<std::uint32_t>(length);
+
+    if (pwrite(region->file, record.data(), length, static_cast<off_t>(entry.offset)) != static_cast<ssize_t>(length))
+    {
+        std::cout << "Error : Could not save chunk " << coord.x << ", " << coord.y << "\n";
+        return;
+    }
+
+    writeEntry(*region, slot, entry);
+    mapRegion(*region);
+}
+
+/**
+ * @brief Function that applies the saved changes (if any) to a freshly generated chunk
+ * Can be called by several threads at once
+ * @param chunk         Chunk generated from the noise
+ */
+void RegionStore::load(Chunk& chunk)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    const ChunkCoord& coord = chunk.getCoord();
+    ChunkCoord regionCoord = getRegionCoord(coord);
+    std::size_t slot = getSlot(coord);
+
+    Region* region = getRegion(regionCoord, false);
+    if (!region)
+        return;
+
+    TableEntry entry = readEntry(*region, slot);
+    if (entry.length < 2 * sizeof(std::uint16_t) || entry.offset + entry.length > region->size)
+        return;
+
+    std::vector<std::uint16_t> record(entry.length / sizeof(std::uint16_t));
+    std::memcpy(record.data(), region->data + entry.offset, record.size() * sizeof(std::uint16_t));
+
+    std::size_t count = static_cast<std::size_t>(record[0]) | (static_cast<std::size_t>(record[1]) << 16);
+    if (2 + 3 * count > record.size())
+        return;
+
+    std::vector<TileChange> changes;
+    changes.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const std::uint16_t* change = &record[2 + 3 * i];
+
+        // Corrupted record : the tile would be read outside of the registry
+        if ((change[1] != GROUND && change[1] != ON_TOP) || change[2] >= TileHandler::getNumberOfTiles())
+        {
+            std::cout << "Error : Invalid saved tile in chunk " << coord.x << ", " << coord.y << "\n";
+            return;
+        }
+
+        changes.push_back(TileChange { change[0], static_cast<Layer>(change[1]), change[2] });
+    }
+
+    chunk.applyChanges(changes);
+}
+
+/**
+ * @brief Function that returns a region (opened the first time it is needed)
+ * @param regionCoord   Coordinates of the region (in regions)
+ * @param create        Whether the file must be created if it does not exist
+ * @return              Region, nullptr if there is no file for this region
+ */
+RegionStore::Region* RegionStore::getRegion(const ChunkCoord& regionCoord, bool create)
+{
+    auto region = regions_.find(regionCoord);
+    if (region != regions_.end() && region->second.file >= 0)
+        return &region->second;
+
+    // The directory of the world only exists once something is saved
+    if (create && !directoryCreated_)
+    {
+        std::error_code error;
+        std::filesystem::create_directories(directory_, error);
+        if (error)
+        {
+            std::cout << "Error : Could not create save directory " << directory_ << " : " << error.message() << "\n";
+            return nullptr;
+        }
+        directoryCreated_ = true;
+    }
+
+    Region& newRegion = regions_[regionCoord];
+    if (!openRegion(newRegion, getRegionPath(regionCoord), create))
+        return nullptr;
+
+    return &newRegion;
+}
+
+/**
+ * @brief Function that opens a region file and checks its header
+ * @param region        Region to open
+ * @param path          Path of the file
+ * @param create        Whether the file must be created if it does not exist (or is not valid)
+ * @return              Region opened or not
+ */
+bool RegionStore::openRegion(Region& region, const std::string& path, bool create)
+{
+    region.file = open(path.c_str(), create ? O_RDWR | O_CREAT : O_RDWR, 0644);
+    if (region.file < 0)
+        return false;
+
+    std::uint32_t header[4] = { 0, 0, 0, 0 };
+    bool valid = pread(region.file, header, sizeof(header), 0) == static_cast<ssize_t>(sizeof(header)) &&
+        header[0] == REGION_MAGIC && header[1] == REGION_VERSION && static_cast<int>(header[2]) == seed_ &&
+        header[3] == TileHandler::getRegistryHash();
+
+    if (!valid)
+    {
+        if (!create)
+        {
+            closeRegion(region);
+            return false;
+        }
+
+        // New (or unreadable) file : empty table
+        std::uint32_t newHeader[4] = { REGION_MAGIC, REGION_VERSION, static_cast<std::uint32_t>(seed_), TileHandler::getRegistryHash() };
+        if (ftruncate(region.file, 0) != 0 ||
+            ftruncate(region.file, static_cast<off_t>(REGION_DATA_START)) != 0 ||
+            pwrite(region.file, newHeader, sizeof(newHeader), 0) != static_cast<ssize_t>(sizeof(newHeader)))
+        {
+            std::cout << "Error : Could not create region file " << path << "\n";
+            closeRegion(region);
+            return false;
+        }
+    }
+
+    mapRegion(region);
+    return region.data != nullptr;
+}
+
+/**
+ * @brief Function that maps the whole region file in memory (again if its size changed)
+ * @param region        Region to map
+ */
+void RegionStore::mapRegion(Region& region)
+{
+    struct stat status;
+    if (fstat(region.file, &status) != 0)
+        return;
+
+    std::size_t size = static_cast<std::size_t>(status.st_size);
+    if (region.data && size == region.size)
+        return;
+
+    if (region.data)
+        munmap(region.data, region.size);
+
+    void* data = mmap(nullptr, size, PROT_READ, MAP_SHARED, region.file, 0);
+    region.data = data == MAP_FAILED ? nullptr : static_cast<char*>(data);
+    region.size = region.data ? size : 0;
+}
+
+/**
+ * @brief Function that closes a region file
+ * @param region        Region to close
+ */
+void RegionStore::closeRegion(Region& region)
+{
+    if (region.data)
+        munmap(region.data, region.size);
+
+    if (region.file >= 0)
+        close(region.file);
+
+    region = Region();
+}
+
+/**
+ * @brief Function that reads the position of a chunk record in the region file
+ * @param region        Region
+ * @param slot          Index of the chunk in the region
+ */
+RegionStore::TableEntry RegionStore::readEntry(const Region& region, std::size_t slot) const
+{
+    TableEntry entry { 0, 0 };
+    std::size_t position = REGION_HEADER_SIZE + slot * 2 * sizeof(std::uint32_t);
+
+    if (region.data && position + 2 * sizeof(std::uint32_t) <= region.size)
+    {
+        std::memcpy(&entry.offset, region.data + position, sizeof(std::uint32_t));
+        std::memcpy(&entry.length, region.data + position + sizeof(std::uint32_t), sizeof(std::uint32_t));
+    }
+
+    return entry;
+}
+
+/**
+ * @brief Function that writes the position of a chunk record in the region file
+ * @param region        Region
+ * @param slot          Index of the chunk in the region
+ * @param entry         Position of the record
+ */
+void RegionStore::writeEntry(Region& region, std::size_t slot, const TableEntry& entry)
+{
+    std::uint32_t values[2] = { entry.offset, entry.length };
+    std::size_t position = REGION_HEADER_SIZE + slot * 2 * sizeof(std::uint32_t);
+
+    if (pwrite(region.file, values, sizeof(values), static_cast<off_t>(position)) != static_cast<ssize_t>(sizeof(values)))
+        std::cout << "Error : Could not write region table\n";
+}
+
+/**
+ * @brief Function that returns the coordinates of the region containing a chunk
+ * @param coord         Coordinates of the chunk
+ */
+ChunkCoord RegionStore::getRegionCoord(const ChunkCoord& coord)
+{
+    return ChunkCoord(floorDivide(coord.x, REGION_SIZE), floorDivide(coord.y, REGION_SIZE));
+}
+
+/**
+ * @brief Function that returns the index of a chunk in its region's table
+ * @param coord         Coordinates of the chunk
+ */
+std::size_t RegionStore::getSlot(const ChunkCoord& coord)
+{
+    ChunkCoord regionCoord = getRegionCoord(coord);
+    return static_cast<std::size_t>((coord.y - regionCoord.y * REGION_SIZE) * REGION_SIZE + (coord.x - regionCoord.x * REGION_SIZE));
+}
+
+/**
+ * @brief Function that returns the path of a region file
+ * @param regionCoord   Coordinates of the region (in regions)
+ */
+std::string RegionStore::getRegionPath(const ChunkCoord& regionCoord) const
+{
+    return directory_ + "/r." + std::to_string(regionCoord.x) + "." + std::to_string(regionCoord.y) + ".bin";
+}
@@ -0,0 +1,61 @@
+#ifndef REGION_STORE_H
+#define REGION_STORE_H
+
+#include "Chunk.h"
+#include "Coordinates.h"
+
+/**
+ * Stores the chunks modified by the player on disk
+ * Chunks are grouped in region files of REGION_SIZE x REGION_SIZE chunks, each file starting
+ * with a table giving the offset and length of every chunk. Only the changes made to a chunk
+ * since its generation are stored (the rest is generated again from the noise)
+ * Tile IDs depend on the order of the tile registry : regions saved with another registry are ignored
+ */
+class RegionStore
+{
+public:
+
+    static constexpr int REGION_SIZE = 32;
+
+    RegionStore(const std::string& directory, int seed);
+    virtual ~RegionStore();
+
+    void save(const Chunk& chunk);
+    void load(Chunk& chunk);
+
+private:
+
+    struct Region
+    {
+        int file = -1;
+        char* data = nullptr;   // File mapped in memory (read only)
+        std::size_t size = 0;
+    };
+
+    struct TableEntry
+    {
+        std::uint32_t offset;
+        std::uint32_t length;
+    };
+
+    Region* getRegion(const ChunkCoord& regionCoord, bool create);
+    bool openRegion(Region& region, const std::string& path, bool create);
+    void mapRegion(Region& region);
+    void closeRegion(Region& region);
+
+    TableEntry readEntry(const Region& region, std::size_t slot) const;
+    void writeEntry(Region& region, std::size_t slot, const TableEntry& entry);
+    std::string getRegionPath(const ChunkCoord& regionCoord) const;
+
+    static ChunkCoord getRegionCoord(const ChunkCoord& coord);
+    static std::size_t getSlot(const ChunkCoord& coord);
+
+    std::string directory_;
+    bool directoryCreated_;         // Created by the first save
+    int seed_;
+
+    std::mutex mutex_;
+    std::unordered_map<ChunkCoord, Region, ChunkCoordHasher> regions_;
+};
+
+#endif
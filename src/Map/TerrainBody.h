@@ -0,0 +1,16 @@
+#ifndef TERRAIN_BODY_H
+#define TERRAIN_BODY_H
+
+#include "../Math/Vector.h"
+
+// Movable entity as seen by the terrain collision pass (stored contiguously, one per entity)
+struct TerrainBody
+{
+    sf::FloatRect aabb;         // Hitbox of the entity (at the end of its movement)
+    Vector movement;            // Movement of the entity during the step (swept from aabb - movement to aabb)
+    Vector velocity;            // Velocity of the entity (the components pushed back are cancelled)
+    Vector offset;              // Push out of the solid blocks
+    bool blocked[4];            // Directions blocked by the terrain (indexed by Direction : left, right, up, down)
+};
+
+#endif
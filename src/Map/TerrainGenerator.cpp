@@ -1,16 +1,55 @@
 #include "../headers.h"
 #include "TerrainGenerator.h"
 
+const std::string TerrainGenerator::SETTINGS_PATH = "config/terrain.ini";
+const std::string TerrainGenerator::BIOMES_PATH = "config/biomes.ini";
+
+/**
+ * @brief Function that loads the settings (each line is : key value)
+ * Missing keys keep their default value
+ * @param path          Path of the settings file
+ */
+void TerrainSettings::load(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string key;
+    float value;
+
+    while (file >> key >> value)
+    {
+        if (key == "octaves")
+            octaves = std::max(1, static_cast<int>(value));
+        else if (key == "persistence")
+            persistence = value;
+        else if (key == "lacunarity")
+            lacunarity = value;
+        else if (key == "height_scale")
+            heightScale = value;
+        else if (key == "climate_scale")
+            climateScale = value;
+        else if (key == "grass_scale")
+            grassScale = value;
+        else
+            std::cout << "Unknown terrain setting : " << key << std::endl;
+    }
+}
+
 /**
  * @brief Constructor
+ * Each field has its own seed : the world seed mixed with the stream of the field
  * @param seed          Seed for the terrain
+ * @param settingsPath  Path of the generation settings
+ * @param biomesPath    Path of the biome table
  */
-TerrainGenerator::TerrainGenerator(int seed)
-    :   mapGenerator_(seed)
-    ,   treeGenerator_(seed ^ (seed + 1))
-    ,   grassGenerator_(seed ^ (seed - 1))
+TerrainGenerator::TerrainGenerator(int seed, const std::string& settingsPath, const std::string& biomesPath)
+    :   seed_(seed)
+    ,   biomes_(biomesPath)
+    ,   heightGenerator_(static_cast<unsigned int>(Random::mix(static_cast<std::uint32_t>(seed) ^ Random::TERRAIN_HEIGHT)))
+    ,   moistureGenerator_(static_cast<unsigned int>(Random::mix(static_cast<std::uint32_t>(seed) ^ Random::TERRAIN_MOISTURE)))
+    ,   temperatureGenerator_(static_cast<unsigned int>(Random::mix(static_cast<std::uint32_t>(seed) ^ Random::TERRAIN_TEMPERATURE)))
+    ,   grassGenerator_(static_cast<unsigned int>(Random::mix(static_cast<std::uint32_t>(seed) ^ Random::TERRAIN_GRASS)))
 {
-
+    settings_.load(settingsPath);
 }
 
 /**
@@ -22,41 +61,146 @@ TerrainGenerator::~TerrainGenerator()
 }
 
 /**
- * @brief Function that generates the map
- * @param position      Position of the tile
- * @return value of the tile at a certain position
+ * @brief Function that generates the tiles of a chunk
+ * Can be called by several threads at once
+ * @param origin        Position of the first tile (in pixels)
+ * @param tileSize      Size of a tile (in pixels)
+ * @param width         Number of tiles per row
+ * @param height        Number of rows
+ * @param ground        Ground layer (row major, width * height)
+ * @param nature        Natural elements layer (row major, width * height)
+ */
+void TerrainGenerator::generate(const Vector& origin, float tileSize, int width, int height,
+        std::vector<TileID>& ground, std::vector<TileID>& nature) const
+{
+    std::size_t size = static_cast<std::size_t>(width * height);
+    std::vector<float> heights(size), octave(size), moisture(size), temperature(size), grass(size);
+
+    generateHeights(origin, tileSize, width, height, heights.data(), octave.data());
+    generateClimate(origin, tileSize, width, height, moisture.data(), temperature.data());
+    grassGenerator_.noise2DGrid(origin.getX(), origin.getY(), tileSize, width, height, grass.data(), settings_.grassScale * tileSize);
+
+    ground.assign(size, TileHandler::NO_TILE);
+    nature.assign(size, TileHandler::NO_TILE);
+    generateBiomes(origin, tileSize, width, height, heights.data(), moisture.data(), temperature.data(), grass.data(), ground, nature);
+}
+
+/**
+ * @brief Function that returns the seed of the terrain
+ * @return Seed
+ */
+int TerrainGenerator::getSeed() const
+{
+    return seed_;
+}
+
+/**
+ * @brief Function that returns the generation settings
  */
-float TerrainGenerator::mapValue(const Vector& position) const
+const TerrainSettings& TerrainGenerator::getSettings() const
 {
-    return mapGenerator_.noise(position.getX(), position.getY(), 0.0);
+    return settings_;
 }
 
 /**
- * @brief Function that returns the map generator
- * @return Map generator
+ * @brief Function that returns the biome table
  */
-int TerrainGenerator::generateNaturalElement(const Vector& position) const
+const BiomeTable& TerrainGenerator::getBiomes() const
 {
-    srand(hash(position));
-    int value = rand() % 80;
-    
-    return value;
+    return biomes_;
 }
 
 /**
- * @brief Function that generates grass
+ * @brief Height stage : fractal brownian motion (sum of octaves of noise), normalized to the range of one octave
+ * @param origin        Position of the first tile (in pixels)
+ * @param tileSize      Size of a tile (in pixels)
+ * @param width         Number of tiles per row
+ * @param height        Number of rows
+ * @param out           Heights (row major, width * height)
+ * @param octave        Buffer of the same size used for each octave
  */
-int TerrainGenerator::generateGrass(const Vector& position) const
+void TerrainGenerator::generateHeights(const Vector& origin, float tileSize, int width, int height, float* out, float* octave) const
 {
-    float height = (grassGenerator_.noise(position.getX() / 64.0f, position.getY() / 64.0f, 0.0f) + 1.0f) * 9.0f;
-    return (static_cast<int>(height) % 9);
+    std::size_t size = static_cast<std::size_t>(width * height);
+    std::fill(out, out + size, 0.0f);
+
+    float scale = settings_.heightScale * tileSize;
+    float amplitude = 1.0f;
+    float total = 0.0f;
+    for (int o = 0; o < settings_.octaves; ++o)
+    {
+        // Octaves are shifted so that they do not all cross zero at the same place
+        float offset = static_cast<float>(o) * 1031.0f * tileSize;
+        heightGenerator_.noise2DGrid(origin.getX() + offset, origin.getY() + offset, tileSize, width, height, octave, scale);
+
+        for (std::size_t i = 0; i < size; ++i)
+            out[i] += amplitude * octave[i];
+
+        total += amplitude;
+        amplitude *= settings_.persistence;
+        scale /= settings_.lacunarity;
+    }
+
+    for (std::size_t i = 0; i < size; ++i)
+        out[i] /= total;
+}
 
+/**
+ * @brief Climate stage : moisture and temperature fields (large features)
+ * @param origin        Position of the first tile (in pixels)
+ * @param tileSize      Size of a tile (in pixels)
+ * @param width         Number of tiles per row
+ * @param height        Number of rows
+ * @param moisture      Moisture (row major, width * height)
+ * @param temperature   Temperature (row major, width * height)
+ */
+void TerrainGenerator::generateClimate(const Vector& origin, float tileSize, int width, int height, float* moisture, float* temperature) const
+{
+    float scale = settings_.climateScale * tileSize;
+    moistureGenerator_.noise2DGrid(origin.getX(), origin.getY(), tileSize, width, height, moisture, scale);
+    temperatureGenerator_.noise2DGrid(origin.getX(), origin.getY(), tileSize, width, height, temperature, scale);
 }
 
 /**
- * @brief Hashing function for pseudo-random number generator
+ * @brief Biome stage : picks the ground and the natural element of each tile from its biome
+ * @param origin        Position of the first tile (in pixels)
+ * @param tileSize      Size of a tile (in pixels)
+ * @param width         Number of tiles per row
+ * @param height        Number of rows
+ * @param heights       Heights computed by the height stage
+ * @param moisture      Moisture computed by the climate stage
+ * @param temperature   Temperature computed by the climate stage
+ * @param grass         Grass noise (picks the variant of the ground)
+ * @param ground        Ground layer
+ * @param nature        Natural elements layer
  */
-unsigned int TerrainGenerator::hash(const Vector& position) const
+void TerrainGenerator::generateBiomes(const Vector& origin, float tileSize, int width, int height,
+        const float* heights, const float* moisture, const float* temperature, const float* grass,
+        std::vector<TileID>& ground, std::vector<TileID>& nature) const
 {
-    return static_cast<unsigned int>(static_cast<int>(position.getX() * position.getY()) ^ (static_cast<int>(position.getY()) << 1));
-}
\ No newline at end of file
+    const GeneratedTiles& tiles = GeneratedTiles::get();
+    int firstX = static_cast<int>(std::floor(origin.getX() / tileSize));
+    int firstY = static_cast<int>(std::floor(origin.getY() / tileSize));
+
+    for (int j = 0; j < height; ++j)
+    {
+        for (int i = 0; i < width; ++i)
+        {
+            std::size_t index = static_cast<std::size_t>(j * width + i);
+            const Biome& biome = biomes_.get(biomes_.find(heights[index], moisture[index], temperature[index]));
+
+            int variants = static_cast<int>(biome.ground.size());
+            int variant = std::max(0, static_cast<int>((grass[index] + 1.0f) * static_cast<float>(variants))) % variants;
+            ground[index] = biome.ground[static_cast<std::size_t>(variant)];
+
+            // Stateless random number : the same for a tile whatever the thread generating it
+            float value = Random::hashFloat(static_cast<std::uint32_t>(seed_), firstX + i, firstY + j, Random::TERRAIN_NATURE);
+            if (value < biome.bush)
+                nature[index] = tiles.bush;
+            else if (value < biome.bush + biome.tree)
+                nature[index] = tiles.tree;
+            else if (value < biome.bush + biome.tree + biome.bigTree)
+                nature[index] = tiles.bigTree;
+        }
+    }
+}
@@ -3,32 +3,60 @@
 
 #include "../Math/PerlinNoise.h"
 #include "../Math/Vector.h"
+#include "../Math/Random.h"
+#include "BiomeTable.h"
 
+// Parameters of the terrain generation
+struct TerrainSettings
+{
+    int octaves = 4;
+    float persistence = 0.5f;       // Amplitude multiplier from one octave to the next
+    float lacunarity = 2.0f;        // Frequency multiplier from one octave to the next
+    float heightScale = 64.0f;      // Size of the features of the first octave (in tiles)
+    float climateScale = 256.0f;    // Size of the moisture and temperature features (in tiles)
+    float grassScale = 2.0f;        // Size of the grass patches (in tiles)
+
+    void load(const std::string& path);
+};
+
+// Generates the tiles of a chunk in stages (height, climate, biomes), every stage working on the whole chunk
 class TerrainGenerator
 {
 public:
 
-    static constexpr float WATER_HEIGHT = -0.1f;
-    static constexpr float SAND_HEIGHT = 0.05f;
-    static constexpr float GRASS_HEIGHT = 0.3f;
+    static const std::string SETTINGS_PATH;
+    static const std::string BIOMES_PATH;
 
-    TerrainGenerator(int seed);
+    TerrainGenerator(int seed,
+            const std::string& settingsPath = SETTINGS_PATH,
+            const std::string& biomesPath = BIOMES_PATH);
     virtual ~TerrainGenerator();
 
+    void generate(const Vector& origin, float tileSize, int width, int height,
+            std::vector<TileID>& ground, std::vector<TileID>& nature) const;
+
     // Getters
-    float mapValue(const Vector& position) const;
-    int generateNaturalElement(const Vector& position) const;
-    int generateGrass(const Vector& position) const;
+    int getSeed() const;
+    const TerrainSettings& getSettings() const;
+    const BiomeTable& getBiomes() const;
 
 private:
 
-    unsigned int hash(const Vector& position) const;
-
-    PerlinNoise mapGenerator_;
-    PerlinNoise treeGenerator_;
+    void generateHeights(const Vector& origin, float tileSize, int width, int height, float* out, float* octave) const;
+    void generateClimate(const Vector& origin, float tileSize, int width, int height, float* moisture, float* temperature) const;
+    void generateBiomes(const Vector& origin, float tileSize, int width, int height,
+            const float* heights, const float* moisture, const float* temperature, const float* grass,
+            std::vector<TileID>& ground, std::vector<TileID>& nature) const;
+
+    int seed_;
+    TerrainSettings settings_;
+    BiomeTable biomes_;
+    PerlinNoise heightGenerator_;
+    PerlinNoise moistureGenerator_;
+    PerlinNoise temperatureGenerator_;
     PerlinNoise grassGenerator_;
 };
 
 
 
-#endif
\ No newline at end of file
+#endif
@@ -5,8 +5,7 @@ const float TileHandler::DEFAULT_SIZE = 32.0f;
 const float TileHandler::TEXTURE_SIZE = 32.0f;
 float TileHandler::SCALE_FACTOR_TEXTURE_SPRITE = TileHandler::TEXTURE_SIZE / TileHandler::DEFAULT_SIZE;
 const std::size_t TileHandler::NUMBER_OF_TEXTURES = 3;
-
-std::unordered_map<std::string, Vector> TileHandler::coordinates_;
+const TileID TileHandler::NO_TILE = 0;
 
 /**
  * @brief Function that returns the singleton
@@ -30,95 +29,101 @@ TileHandler::~TileHandler()
  * @brief Constructor
  */
 TileHandler::TileHandler()
+    :   registryHash_(0)
 {
-   loadCoordinates();
+   loadTiles();
 }
 
 /**
- * @brief Function that loads the coordinates of specific tiles into the map
+ * @brief Function that loads every tile into the registry and gives them an ID
+ * Format of a line : name x y width height solid layer
  */
-void TileHandler::loadCoordinates()
+void TileHandler::loadTiles()
 {
+    // ID 0 is reserved for the empty tile
+    tiles_.push_back(TileInfo { "", sf::IntRect(), Vector(0.0f), false, GROUND });
+
     std::ifstream file("config/block_id_mbm.ini");
-    std::string id;
-    int x, y;
+    std::string name;
+    int x, y, width, height, layer;
+    bool solid;
     
-    while (file >> id >> x >> y)
+    while (file >> name >> x >> y >> width >> height >> solid >> layer)
+    {
+        sf::IntRect textureRect(
+            x, y,
+            static_cast<int>(static_cast<float>(width) * TileHandler::TEXTURE_SIZE),
+            static_cast<int>(static_cast<float>(height) * TileHandler::TEXTURE_SIZE)
+        );
+
+        ids_.emplace(name, static_cast<TileID>(tiles_.size()));
+        tiles_.push_back(TileInfo { name, textureRect, Vector(width, height), solid, static_cast<Layer>(layer) });
+    }
+
+    // FNV-1a of the names in the order of their IDs
+    registryHash_ = 2166136261u;
+    for (const TileInfo& tile : tiles_)
     {
-        TileHandler::coordinates_.emplace(id.data(), Vector(x, y));
+        for (char character : tile.name + "\n")
+        {
+            registryHash_ ^= static_cast<std::uint8_t>(character);
+            registryHash_ *= 16777619u;
+        }
     }
 
 }
 
 /**
- * @brief Function that returns a sprite of a certain block
- * @param blockID       ID of the block @see block_id.ini
+ * @brief Function that returns a sprite of a certain tile
+ * @param id            ID of the tile
  * @param texture       Pointer to texture
- * @param tileSize      Tile size
  */
-sf::Sprite TileHandler::I_getSpriteFromChar(const std::string& blockID, std::shared_ptr<sf::Texture> texture, const Vector& tileSize) const
+sf::Sprite TileHandler::I_getSpriteFromID(TileID id, std::shared_ptr<sf::Texture> texture) const
 {
-    sf::IntRect textureRect;
     sf::Sprite sprite;
-    Vector textureSize = getTextureSize(blockID);
 
     sprite.setScale(1.0f / TileHandler::SCALE_FACTOR_TEXTURE_SPRITE, 1.0f / TileHandler::SCALE_FACTOR_TEXTURE_SPRITE);
     sprite.setTexture(*texture);
-    try {
-        Vector coordinate = getTextureCoordinates(blockID);
-        textureRect = sf::IntRect(
-            coordinate.getAsVector2i(),
-            Vector(textureSize.getX() * tileSize.getX() * TileHandler::SCALE_FACTOR_TEXTURE_SPRITE,
-                    textureSize.getY() * tileSize.getY() * TileHandler::SCALE_FACTOR_TEXTURE_SPRITE).getAsVector2i()
-        );
-    } catch (TileNotFound& e)
-    {
-        std::cout << e.what() << "\n";
-    }
-
-    sprite.setTextureRect(textureRect);
+    sprite.setTextureRect(tiles_[id].textureRect);
 
     return sprite;
 }
 
 /**
- * @brief Function that returns whether a certain block is solid or not
- * @param blockID       Block's id
+ * @brief Function that returns the ID of a tile from its name
+ * Names are only used when loading, IDs are used everywhere else
+ * @param name          Name of the tile @see block_id_mbm.ini
  */
-bool TileHandler::I_isBlockSolid(const std::string& blockID) const
+TileID TileHandler::I_getID(const std::string& name) const
 {
-    return blockID == "water" || blockID == "big_tree";
+    const auto& id = ids_.find(name);
+    if (id == ids_.end())
+    {
+        std::cout << "Id : " << name << "\n";
+        throw TileNotFound("Texture not found");
+    }
+
+    return id->second;
 }
 
 /**
- * @brief Function that returns the texture size based on the id
- * @param blockID       Block's id
+ * @brief Constructor (looks up the IDs in the tile registry)
  */
-Vector TileHandler::getTextureSize(const std::string& blockID) const
+GeneratedTiles::GeneratedTiles()
+    :   water(TileHandler::getID("water"))
+    ,   sand(TileHandler::getID("sand"))
+    ,   tree(TileHandler::getID("tree"))
+    ,   bigTree(TileHandler::getID("big_tree"))
+    ,   bush(TileHandler::getID("bush"))
 {
-    if (blockID == "tree")
-    {
-        return Vector(1, 2);    
-    }
-
-    if (blockID == "big_tree")
-    {
-        return Vector(2, 3);
-    }
 
-    return Vector(1, 1);
 }
 
 /**
- * @brief Function that returns the position of the texture in the tile texture sheet based on the ID
+ * @brief Function that returns the IDs of the generated tiles
  */
-Vector TileHandler::getTextureCoordinates(const std::string& blockID) const
+const GeneratedTiles& GeneratedTiles::get()
 {
-    if (TileHandler::coordinates_.find(blockID) == coordinates_.end())
-    {
-        std::cout << "Id : " << blockID << "\n";
-        throw TileNotFound("Texture not found");
-    }
-
-    return TileHandler::coordinates_.at(blockID);
+    static const GeneratedTiles tiles;
+    return tiles;
 }
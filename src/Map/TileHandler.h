@@ -9,6 +9,23 @@ enum Type {
     SOLID
 };
 
+enum Layer {
+    GROUND,
+    ON_TOP
+};
+
+// Compact identifier of a tile (index in the tile registry)
+typedef std::uint16_t TileID;
+
+struct TileInfo
+{
+    std::string name;
+    sf::IntRect textureRect;    // Rectangle in the texture sheet
+    Vector footprint;           // Size in tiles
+    bool solid;
+    Layer layer;
+};
+
 // Singleton class
 class TileHandler
 {
@@ -19,17 +36,46 @@ public:
     static float SCALE_FACTOR_TEXTURE_SPRITE;
     static const std::size_t NUMBER_OF_TEXTURES;
 
+    // ID of an empty tile (no texture)
+    static const TileID NO_TILE;
+
     TileHandler(const TileHandler&) = delete;
     void operator=(const TileHandler&) = delete;
 
-    static sf::Sprite getSpriteFromChar(const std::string& blockID, std::shared_ptr<sf::Texture> texture, const Vector& tileSize = Vector(TileHandler::DEFAULT_SIZE))
+    static sf::Sprite getSpriteFromID(TileID id, std::shared_ptr<sf::Texture> texture)
     {
-        return getInstance().I_getSpriteFromChar(blockID, texture, tileSize);
+        return getInstance().I_getSpriteFromID(id, texture);
     }
 
-    static bool isBlockSolid(const std::string& blockID)
+    static TileID getID(const std::string& name)
     {
-        return getInstance().I_isBlockSolid(blockID);
+        return getInstance().I_getID(name);
+    }
+
+    static const TileInfo& getTileInfo(TileID id)
+    {
+        return getInstance().tiles_[id];
+    }
+
+    static const sf::IntRect& getTextureRect(TileID id)
+    {
+        return getTileInfo(id).textureRect;
+    }
+
+    static bool isBlockSolid(TileID id)
+    {
+        return getTileInfo(id).solid;
+    }
+
+    static std::size_t getNumberOfTiles()
+    {
+        return getInstance().tiles_.size();
+    }
+
+    // Changes when the tiles are added, removed or reordered (saved with the modified chunks)
+    static std::uint32_t getRegistryHash()
+    {
+        return getInstance().registryHash_;
     }
 
     static TileHandler& getInstance();
@@ -39,13 +85,28 @@ private:
 
     TileHandler();
 
-    void loadCoordinates();
-    sf::Sprite I_getSpriteFromChar(const std::string& blockID, std::shared_ptr<sf::Texture> texture, const Vector& tileSize = Vector(TileHandler::DEFAULT_SIZE)) const;
-    bool I_isBlockSolid(const std::string& blockID) const ;
-    Vector getTextureSize(const std::string& blockID) const;
-    Vector getTextureCoordinates(const std::string& blockID) const;
+    void loadTiles();
+    sf::Sprite I_getSpriteFromID(TileID id, std::shared_ptr<sf::Texture> texture) const;
+    TileID I_getID(const std::string& name) const;
+
+    // Tiles indexed by their ID (loaded once from block_id_mbm.ini)
+    std::vector<TileInfo> tiles_;
+    std::unordered_map<std::string, TileID> ids_;
+    std::uint32_t registryHash_;
+};
+
+// IDs of the tiles placed by the terrain generation (resolved once from the tile registry)
+struct GeneratedTiles
+{
+    GeneratedTiles();
+
+    static const GeneratedTiles& get();
 
-    static std::unordered_map<std::string, Vector> coordinates_;
+    TileID water;
+    TileID sand;
+    TileID tree;
+    TileID bigTree;
+    TileID bush;
 };
 
 #endif
\ No newline at end of file
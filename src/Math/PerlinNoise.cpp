@@ -1,6 +1,279 @@
 #include "../headers.h"
 #include "PerlinNoise.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+    #define PERLIN_NOISE_X86
+    #include <immintrin.h>
+#endif
+
+namespace
+{
+
+typedef void (*GridKernel)(const int* p, float originX, float originY, float step, float scale, int width, int height, float* out);
+
+/**
+ * @brief Function that computes a single 2D sample (noise with z = 0, where the last lerp and z terms vanish)
+ * @param p         Permutation table (512 entries)
+ * @param x         x position
+ * @param y         y position
+ */
+inline float sample2D(const int* p, float x, float y)
+{
+    int X = (int) std::floor(x) & 255, Y = (int) std::floor(y) & 255;
+    x -= std::floor(x);
+    y -= std::floor(y);
+
+    float u = PerlinNoise::fade(x), v = PerlinNoise::fade(y);
+    int A = p[X] + Y,
+        B = p[X + 1] + Y;
+
+    return PerlinNoise::lerp(v, PerlinNoise::lerp(u, PerlinNoise::grad2D(p[p[A]], x, y),
+                PerlinNoise::grad2D(p[p[B]], x - 1, y)),
+                PerlinNoise::lerp(u, PerlinNoise::grad2D(p[p[A + 1]], x, y - 1),
+                PerlinNoise::grad2D(p[p[B + 1]], x - 1, y - 1)));
+}
+
+/**
+ * @brief Scalar kernel filling a grid of samples
+ * @param p         Permutation table (512 entries)
+ * @param originX   x position of the first sample (before scaling)
+ * @param originY   y position of the first sample (before scaling)
+ * @param step      Distance between two samples (before scaling)
+ * @param scale     Every position is divided by the scale
+ * @param width     Number of samples per row
+ * @param height    Number of rows
+ * @param out       Samples (row major, width * height)
+ */
+void gridScalar(const int* p, float originX, float originY, float step, float scale, int width, int height, float* out)
+{
+    for (int j = 0; j < height; ++j)
+    {
+        float y = (originY + static_cast<float>(j) * step) / scale;
+        for (int i = 0; i < width; ++i)
+        {
+            float x = (originX + static_cast<float>(i) * step) / scale;
+            *out++ = sample2D(p, x, y);
+        }
+    }
+}
+
+#ifdef PERLIN_NOISE_X86
+
+/**
+ * @brief Grad function on 4 samples (z = 0)
+ */
+__attribute__((target("sse4.1")))
+inline __m128 grad2DSSE(__m128i hash, __m128 x, __m128 y)
+{
+    __m128i h = _mm_and_si128(hash, _mm_set1_epi32(15));
+    __m128 lessThan8 = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(8)));
+    __m128 lessThan4 = _mm_castsi128_ps(_mm_cmplt_epi32(h, _mm_set1_epi32(4)));
+    __m128 is12or14 = _mm_castsi128_ps(_mm_or_si128(_mm_cmpeq_epi32(h, _mm_set1_epi32(12)), _mm_cmpeq_epi32(h, _mm_set1_epi32(14))));
+
+    __m128 u = _mm_blendv_ps(y, x, lessThan8);
+    __m128 v = _mm_blendv_ps(_mm_and_ps(is12or14, x), y, lessThan4);
+
+    // Negating a float only flips its sign bit
+    __m128 signU = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(1)), 31));
+    __m128 signV = _mm_castsi128_ps(_mm_slli_epi32(_mm_and_si128(h, _mm_set1_epi32(2)), 30));
+    return _mm_add_ps(_mm_xor_ps(u, signU), _mm_xor_ps(v, signV));
+}
+
+/**
+ * @brief Lookup of 4 entries of the permutation table (SSE has no gather)
+ */
+__attribute__((target("sse4.1")))
+inline __m128i lookupSSE(const int* p, __m128i indices)
+{
+    alignas(16) int i[4];
+    _mm_store_si128(reinterpret_cast<__m128i*>(i), indices);
+    return _mm_setr_epi32(p[i[0]], p[i[1]], p[i[2]], p[i[3]]);
+}
+
+/**
+ * @brief Fade function on 4 samples
+ */
+__attribute__((target("sse4.1")))
+inline __m128 fadeSSE(__m128 t)
+{
+    __m128 inner = _mm_add_ps(_mm_mul_ps(t, _mm_sub_ps(_mm_mul_ps(t, _mm_set1_ps(6.0f)), _mm_set1_ps(15.0f))), _mm_set1_ps(10.0f));
+    return _mm_mul_ps(_mm_mul_ps(_mm_mul_ps(t, t), t), inner);
+}
+
+/**
+ * @brief Lerp function on 4 samples
+ */
+__attribute__((target("sse4.1")))
+inline __m128 lerpSSE(__m128 t, __m128 a, __m128 b)
+{
+    return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+}
+
+/**
+ * @brief SSE4.1 kernel filling a grid of samples, 4 samples at a time (same parameters as gridScalar)
+ */
+__attribute__((target("sse4.1")))
+void gridSSE(const int* p, float originX, float originY, float step, float scale, int width, int height, float* out)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128i oneI = _mm_set1_epi32(1);
+    const __m128i mask = _mm_set1_epi32(255);
+
+    for (int j = 0; j < height; ++j)
+    {
+        float y = (originY + static_cast<float>(j) * step) / scale;
+        int Y = (int) std::floor(y) & 255;
+        y -= std::floor(y);
+
+        __m128 yv = _mm_set1_ps(y);
+        __m128 y1 = _mm_set1_ps(y - 1);
+        __m128 v = _mm_set1_ps(PerlinNoise::fade(y));
+        __m128i Yv = _mm_set1_epi32(Y);
+
+        int i = 0;
+        for (; i + 4 <= width; i += 4)
+        {
+            __m128 index = _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32(i), _mm_setr_epi32(0, 1, 2, 3)));
+            __m128 x = _mm_div_ps(_mm_add_ps(_mm_set1_ps(originX), _mm_mul_ps(index, _mm_set1_ps(step))), _mm_set1_ps(scale));
+            __m128 floorX = _mm_floor_ps(x);
+            __m128i X = _mm_and_si128(_mm_cvttps_epi32(floorX), mask);
+            x = _mm_sub_ps(x, floorX);
+            __m128 x1 = _mm_sub_ps(x, one);
+            __m128 u = fadeSSE(x);
+
+            __m128i A = _mm_add_epi32(lookupSSE(p, X), Yv);
+            __m128i B = _mm_add_epi32(lookupSSE(p, _mm_add_epi32(X, oneI)), Yv);
+            __m128i AA = lookupSSE(p, lookupSSE(p, A));
+            __m128i BA = lookupSSE(p, lookupSSE(p, B));
+            __m128i AB = lookupSSE(p, lookupSSE(p, _mm_add_epi32(A, oneI)));
+            __m128i BB = lookupSSE(p, lookupSSE(p, _mm_add_epi32(B, oneI)));
+
+            __m128 result = lerpSSE(v, lerpSSE(u, grad2DSSE(AA, x, yv), grad2DSSE(BA, x1, yv)),
+                                       lerpSSE(u, grad2DSSE(AB, x, y1), grad2DSSE(BB, x1, y1)));
+            _mm_storeu_ps(out + i, result);
+        }
+
+        for (; i < width; ++i)
+        {
+            float x = (originX + static_cast<float>(i) * step) / scale;
+            out[i] = sample2D(p, x, (originY + static_cast<float>(j) * step) / scale);
+        }
+
+        out += width;
+    }
+}
+
+/**
+ * @brief Grad function on 8 samples (z = 0)
+ */
+__attribute__((target("avx2")))
+inline __m256 grad2DAVX2(__m256i hash, __m256 x, __m256 y)
+{
+    __m256i h = _mm256_and_si256(hash, _mm256_set1_epi32(15));
+    __m256 lessThan8 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(8), h));
+    __m256 lessThan4 = _mm256_castsi256_ps(_mm256_cmpgt_epi32(_mm256_set1_epi32(4), h));
+    __m256 is12or14 = _mm256_castsi256_ps(_mm256_or_si256(_mm256_cmpeq_epi32(h, _mm256_set1_epi32(12)), _mm256_cmpeq_epi32(h, _mm256_set1_epi32(14))));
+
+    __m256 u = _mm256_blendv_ps(y, x, lessThan8);
+    __m256 v = _mm256_blendv_ps(_mm256_and_ps(is12or14, x), y, lessThan4);
+
+    // Negating a float only flips its sign bit
+    __m256 signU = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(1)), 31));
+    __m256 signV = _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_and_si256(h, _mm256_set1_epi32(2)), 30));
+    return _mm256_add_ps(_mm256_xor_ps(u, signU), _mm256_xor_ps(v, signV));
+}
+
+/**
+ * @brief Fade function on 8 samples
+ */
+__attribute__((target("avx2")))
+inline __m256 fadeAVX2(__m256 t)
+{
+    __m256 inner = _mm256_add_ps(_mm256_mul_ps(t, _mm256_sub_ps(_mm256_mul_ps(t, _mm256_set1_ps(6.0f)), _mm256_set1_ps(15.0f))), _mm256_set1_ps(10.0f));
+    return _mm256_mul_ps(_mm256_mul_ps(_mm256_mul_ps(t, t), t), inner);
+}
+
+/**
+ * @brief Lerp function on 8 samples
+ */
+__attribute__((target("avx2")))
+inline __m256 lerpAVX2(__m256 t, __m256 a, __m256 b)
+{
+    return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+}
+
+/**
+ * @brief AVX2 kernel filling a grid of samples, 8 samples at a time (same parameters as gridScalar)
+ */
+__attribute__((target("avx2")))
+void gridAVX2(const int* p, float originX, float originY, float step, float scale, int width, int height, float* out)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256i oneI = _mm256_set1_epi32(1);
+    const __m256i mask = _mm256_set1_epi32(255);
+
+    for (int j = 0; j < height; ++j)
+    {
+        float y = (originY + static_cast<float>(j) * step) / scale;
+        int Y = (int) std::floor(y) & 255;
+        y -= std::floor(y);
+
+        __m256 yv = _mm256_set1_ps(y);
+        __m256 y1 = _mm256_set1_ps(y - 1);
+        __m256 v = _mm256_set1_ps(PerlinNoise::fade(y));
+        __m256i Yv = _mm256_set1_epi32(Y);
+
+        int i = 0;
+        for (; i + 8 <= width; i += 8)
+        {
+            __m256 index = _mm256_cvtepi32_ps(_mm256_add_epi32(_mm256_set1_epi32(i), _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7)));
+            __m256 x = _mm256_div_ps(_mm256_add_ps(_mm256_set1_ps(originX), _mm256_mul_ps(index, _mm256_set1_ps(step))), _mm256_set1_ps(scale));
+            __m256 floorX = _mm256_floor_ps(x);
+            __m256i X = _mm256_and_si256(_mm256_cvttps_epi32(floorX), mask);
+            x = _mm256_sub_ps(x, floorX);
+            __m256 x1 = _mm256_sub_ps(x, one);
+            __m256 u = fadeAVX2(x);
+
+            __m256i A = _mm256_add_epi32(_mm256_i32gather_epi32(p, X, 4), Yv);
+            __m256i B = _mm256_add_epi32(_mm256_i32gather_epi32(p, _mm256_add_epi32(X, oneI), 4), Yv);
+            __m256i AA = _mm256_i32gather_epi32(p, _mm256_i32gather_epi32(p, A, 4), 4);
+            __m256i BA = _mm256_i32gather_epi32(p, _mm256_i32gather_epi32(p, B, 4), 4);
+            __m256i AB = _mm256_i32gather_epi32(p, _mm256_i32gather_epi32(p, _mm256_add_epi32(A, oneI), 4), 4);
+            __m256i BB = _mm256_i32gather_epi32(p, _mm256_i32gather_epi32(p, _mm256_add_epi32(B, oneI), 4), 4);
+
+            __m256 result = lerpAVX2(v, lerpAVX2(u, grad2DAVX2(AA, x, yv), grad2DAVX2(BA, x1, yv)),
+                                        lerpAVX2(u, grad2DAVX2(AB, x, y1), grad2DAVX2(BB, x1, y1)));
+            _mm256_storeu_ps(out + i, result);
+        }
+
+        for (; i < width; ++i)
+        {
+            float x = (originX + static_cast<float>(i) * step) / scale;
+            out[i] = sample2D(p, x, (originY + static_cast<float>(j) * step) / scale);
+        }
+
+        out += width;
+    }
+}
+
+#endif
+
+/**
+ * @brief Function that picks the fastest kernel supported by the CPU
+ */
+GridKernel selectGridKernel()
+{
+#ifdef PERLIN_NOISE_X86
+    __builtin_cpu_init();
+    if (__builtin_cpu_supports("avx2"))
+        return gridAVX2;
+    if (__builtin_cpu_supports("sse4.1"))
+        return gridSSE;
+#endif
+    return gridScalar;
+}
+
+}
 
 /**
  * @brief Constructor
@@ -9,13 +282,11 @@
 PerlinNoise::PerlinNoise(unsigned int seed)
     :   seed_(seed)
 {
-    permutation_.resize(256);
-
-    std::iota(permutation_.begin(), permutation_.end(), 0);
+    std::iota(permutation_.begin(), permutation_.begin() + 256, 0);
     std::default_random_engine engine(seed);
-    std::shuffle(permutation_.begin(), permutation_.end(), engine);
-    permutation_.insert(permutation_.end(), permutation_.begin(), permutation_.end());
- 
+    std::shuffle(permutation_.begin(), permutation_.begin() + 256, engine);
+    std::copy(permutation_.begin(), permutation_.begin() + 256, permutation_.begin() + 256);
+
 }
 
 /**
@@ -38,12 +309,12 @@ float PerlinNoise::noise(float x, float y, float z) const
     y -= std::floor(y);
     z -= std::floor(z);
 
-    double u = fade(x), v = fade(y), w = fade(z);
-    int A = permutation_[X] + Y, 
-        AA = permutation_[A] + Z, 
-        AB = permutation_[A + 1] + Z, 
-        B = permutation_[X + 1] + Y, 
-        BA = permutation_[B] + Z, 
+    float u = fade(x), v = fade(y), w = fade(z);
+    int A = permutation_[X] + Y,
+        AA = permutation_[A] + Z,
+        AB = permutation_[A + 1] + Z,
+        B = permutation_[X + 1] + Y,
+        BA = permutation_[B] + Z,
         BB = permutation_[B + 1] + Z;
 
     return lerp(w, lerp(v, lerp(u, grad(permutation_[AA], x, y, z),
@@ -53,31 +324,32 @@ float PerlinNoise::noise(float x, float y, float z) const
                 lerp(v, lerp(u, grad(permutation_[AA + 1], x, y, z - 1),
                 grad(permutation_[BA + 1], x - 1, y, z - 1)),
                 lerp(u, grad(permutation_[AB + 1], x, y - 1, z - 1),
-                grad(permutation_[BB+1], x - 1, y - 1, z - 1))));  
+                grad(permutation_[BB+1], x - 1, y - 1, z - 1))));
 }
 
 /**
- * @brief Fade function
+ * @brief Function that generates a value in 2D (same result as noise(x, y, 0))
+ * @param x     x position
+ * @param y     y position
  */
-float PerlinNoise::fade(float t) const
+float PerlinNoise::noise2D(float x, float y) const
 {
-    return t * t * t * (t * (t * 6 - 15) + 10); 
-}
-
-/**
- * @brief Lerp function
- */
-float PerlinNoise::lerp(float t, float a, float b) const
-{ 
-    return a + t * (b - a); 
+    return sample2D(permutation_.data(), x, y);
 }
 
 /**
- * @brief Grad function
+ * @brief Function that generates a whole grid of values in one call (same results as noise2D)
+ * Uses AVX2 or SSE4.1 when the CPU supports it
+ * @param originX   x position of the first value
+ * @param originY   y position of the first value
+ * @param step      Distance between two values
+ * @param width     Number of values per row
+ * @param height    Number of rows
+ * @param out       Values (row major, width * height)
+ * @param scale     Every position is divided by the scale : value(i, j) = noise2D((originX + i * step) / scale, (originY + j * step) / scale)
  */
-float PerlinNoise::grad(int hash, float x, float y, float z) const
+void PerlinNoise::noise2DGrid(float originX, float originY, float step, int width, int height, float* out, float scale) const
 {
-    int h = hash & 15;                      
-    float u = h < 8 ? x : y, v = h < 4 ? y : h == 12 || h == 14 ? x : z;
-    return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
-}
\ No newline at end of file
+    static const GridKernel kernel = selectGridKernel();
+    kernel(permutation_.data(), originX, originY, step, scale, width, height, out);
+}
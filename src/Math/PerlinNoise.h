@@ -8,15 +8,36 @@ public:
     virtual ~PerlinNoise();
 
     float noise(float x, float y, float z) const;
+    float noise2D(float x, float y) const;
+    void noise2DGrid(float originX, float originY, float step, int width, int height, float* out, float scale = 1.0f) const;
 
-private:
+    // Exposed so that the grid kernels share the exact same arithmetic as the scalar noise
+    static inline float fade(float t)
+    {
+        return t * t * t * (t * (t * 6 - 15) + 10);
+    }
+
+    static inline float lerp(float t, float a, float b)
+    {
+        return a + t * (b - a);
+    }
+
+    static inline float grad(int hash, float x, float y, float z)
+    {
+        int h = hash & 15;
+        float u = h < 8 ? x : y, v = h < 4 ? y : h == 12 || h == 14 ? x : z;
+        return ((h & 1) == 0 ? u : -u) + ((h & 2) == 0 ? v : -v);
+    }
 
-    float fade(float t) const;
-    float lerp(float t, float a, float b) const;
-    float grad(int hash, float x, float y, float z) const;
+    static inline float grad2D(int hash, float x, float y)
+    {
+        return grad(hash, x, y, 0.0f);
+    }
+
+private:
 
     unsigned int seed_;
-    std::vector<int> permutation_;
+    std::array<int, 512> permutation_;
 };
 
-#endif
\ No newline at end of file
+#endif
@@ -0,0 +1,120 @@
+#include "../headers.h"
+#include "Random.h"
+
+/**
+ * @brief SplitMix64 finalizer : scrambles every bit of a value
+ * @param value     Value to scramble
+ */
+std::uint64_t Random::mix(std::uint64_t value)
+{
+    value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+    return value ^ (value >> 31);
+}
+
+/**
+ * @brief Function that returns a random number for a position
+ * @param seed      Seed of the world
+ * @param x         X coordinate
+ * @param y         Y coordinate
+ * @param stream    Stream of numbers (one per use)
+ */
+std::uint32_t Random::hash(std::uint64_t seed, int x, int y, std::uint32_t stream)
+{
+    std::uint64_t key = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(x)) << 32) | static_cast<std::uint32_t>(y);
+    std::uint64_t value = mix(key ^ mix(seed + 0x9E3779B97F4A7C15ULL * (static_cast<std::uint64_t>(stream) + 1)));
+    return static_cast<std::uint32_t>(value >> 32);
+}
+
+/**
+ * @brief Function that returns a random number in [0, 1) for a position (see hash)
+ * @param seed      Seed of the world
+ * @param x         X coordinate
+ * @param y         Y coordinate
+ * @param stream    Stream of numbers (one per use)
+ */
+float Random::hashFloat(std::uint64_t seed, int x, int y, std::uint32_t stream)
+{
+    // 24 bits : every value is exactly representable
+    return static_cast<float>(hash(seed, x, y, stream) >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Function that creates a new seed (different for every call and every run)
+ */
+std::uint64_t Random::createSeed()
+{
+    static std::atomic<std::uint64_t> counter(0);
+
+    std::random_device device;
+    std::uint64_t entropy = (static_cast<std::uint64_t>(device()) << 32) | device();
+    std::uint64_t time = static_cast<std::uint64_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count());
+    return mix(entropy ^ mix(time + counter.fetch_add(1)));
+}
+
+/**
+ * @brief Constructor
+ * @param seed      Seed of the generator
+ * @param stream    Stream selected (two streams with the same seed give different numbers)
+ */
+RandomStream::RandomStream(std::uint64_t seed, std::uint64_t stream)
+    :   state_(0)
+    ,   increment_((stream << 1) | 1)
+{
+    next();
+    state_ += seed;
+    next();
+}
+
+/**
+ * @brief Destructor
+ */
+RandomStream::~RandomStream()
+{
+
+}
+
+/**
+ * @brief Function that returns the next number (PCG32, XSH RR)
+ */
+std::uint32_t RandomStream::next()
+{
+    std::uint64_t old = state_;
+    state_ = old * 6364136223846793005ULL + increment_;
+
+    std::uint32_t shifted = static_cast<std::uint32_t>(((old >> 18) ^ old) >> 27);
+    std::uint32_t rotation = static_cast<std::uint32_t>(old >> 59);
+    return (shifted >> rotation) | (shifted << ((32 - rotation) & 31));
+}
+
+/**
+ * @brief Function that returns the next number in [0, 1)
+ */
+float RandomStream::nextFloat()
+{
+    return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief Function that returns the next number in [min, max)
+ * @param min       Minimum
+ * @param max       Maximum (excluded)
+ */
+float RandomStream::nextFloat(float min, float max)
+{
+    return min + nextFloat() * (max - min);
+}
+
+/**
+ * @brief Function that returns the next integer in [min, max]
+ * @param min       Minimum
+ * @param max       Maximum (included)
+ */
+int RandomStream::nextInt(int min, int max)
+{
+    std::uint64_t range = static_cast<std::uint64_t>(static_cast<std::int64_t>(max) - min) + 1;
+
+    // Scales the 32 bits to the range (faster than a modulo)
+    std::uint64_t value = (static_cast<std::uint64_t>(next()) * range) >> 32;
+    return static_cast<int>(static_cast<std::int64_t>(min) + static_cast<std::int64_t>(value));
+}
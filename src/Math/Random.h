@@ -0,0 +1,58 @@
+#ifndef RANDOM_H
+#define RANDOM_H
+
+// Stateless random numbers : hash of a seed, integer coordinates and a stream
+// The same inputs always give the same number, whatever the thread (world generation)
+class Random
+{
+public:
+
+    // Streams used by the different systems (same seed and position, independent numbers)
+    enum Stream : std::uint32_t
+    {
+        TERRAIN_NATURE = 1,
+        DEMON_SPAWNER = 2,
+        TERRAIN_HEIGHT = 3,
+        TERRAIN_MOISTURE = 4,
+        TERRAIN_TEMPERATURE = 5,
+        TERRAIN_GRASS = 6,
+        INPUT_SCRIPT = 7
+    };
+
+    Random() = delete;
+
+    static std::uint64_t mix(std::uint64_t value);
+    static std::uint32_t hash(std::uint64_t seed, int x, int y, std::uint32_t stream = 0);
+    static float hashFloat(std::uint64_t seed, int x, int y, std::uint32_t stream = 0);
+
+    static std::uint64_t createSeed();
+};
+
+// Seeded generator (PCG32) owned by a single system (gameplay)
+// Each system has its own stream : no shared state between systems or threads
+class RandomStream
+{
+public:
+
+    typedef std::uint32_t result_type;
+
+    RandomStream(std::uint64_t seed, std::uint64_t stream = 0);
+    virtual ~RandomStream();
+
+    std::uint32_t next();
+    float nextFloat();
+    float nextFloat(float min, float max);
+    int nextInt(int min, int max);
+
+    // UniformRandomBitGenerator (usable with the standard distributions and algorithms)
+    result_type operator()() { return next(); }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+private:
+
+    std::uint64_t state_;
+    std::uint64_t increment_;
+};
+
+#endif
@@ -71,9 +71,9 @@ public:
 class VectorEqual
 {
 public:
-    std::size_t operator()(const Vector& v1, const Vector& v2) const
+    bool operator()(const Vector& v1, const Vector& v2) const
     {
-        return v1.getX() == v2.getX() && v1.getY() && v2.getY();
+        return v1.getX() == v2.getX() && v1.getY() == v2.getY();
     }
 
 
@@ -1,5 +1,6 @@
 #include "../headers.h"
 #include "PauseMenu.h"
+#include "../Render/ResourceCache.h"
 
 /**
  * @brief Constructor
@@ -54,7 +55,7 @@ void PauseMenu::updateMousePosition(Vector mousePosition)
  *  @brief Method that renders the game state
  *  @param target   RenderWindow where the state will be drawn
  */
-void PauseMenu::render(std::shared_ptr<sf::RenderTarget> target)
+void PauseMenu::render(std::shared_ptr<RenderSnapshot> target)
 {
     target->draw(background_);
 
@@ -75,7 +76,7 @@ void PauseMenu::addButton(const std::string& key, Vector position, gui::ColorBut
     buttons_.emplace(key, std::make_unique<gui::Button>(
         position,
         Vector(gui::Button::BUTTON_SIZE_X, gui::Button::BUTTON_SIZE_Y),
-        &font_,
+        font_.get(),
         handler,
         title
     ));
@@ -117,11 +118,8 @@ bool PauseMenu::isButtonPressed(const std::string& key)
  */
 void PauseMenu::initFonts()
 {
-    if (!font_.loadFromFile("fonts/basic_font.ttf"))
-    {
-        throw("Error : Could not load font : basic_font.ttf");
-    }
-    
+    // Shared with the game state (loaded by the loading screen)
+    font_ = ResourceCache::getFont("fonts/basic_font.ttf");
 }
 
 /**
@@ -129,7 +127,7 @@ void PauseMenu::initFonts()
  */
 void PauseMenu::initPausedText()
 {
-    pausedText_.setFont(font_);
+    pausedText_.setFont(*font_);
     pausedText_.setString("PAUSED");
     pausedText_.setFillColor(sf::Color(255, 255, 255, 200));
     pausedText_.setCharacterSize(25);
@@ -14,7 +14,7 @@ public:
 
     // Functions
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> window);
+    virtual void render(std::shared_ptr<RenderSnapshot> window);
     virtual void updateMousePosition(Vector mousePosition);
 
     virtual void addButton(const std::string& key, Vector position, gui::ColorButtonHandler handler, const std::string& title);
@@ -30,7 +30,7 @@ private:
     // Variables
     std::shared_ptr<sf::RenderTarget> window_;
     sf::RectangleShape background_;
-    sf::Font font_;
+    std::shared_ptr<sf::Font> font_;
     sf::Text pausedText_;
     std::unordered_map<std::string, std::unique_ptr<gui::Button>> buttons_;
 };
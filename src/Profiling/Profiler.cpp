@@ -0,0 +1,254 @@
+#include "../headers.h"
+#include "Profiler.h"
+
+namespace
+{
+
+// Buffer of the current thread, marked as finished when the thread ends (the profiler keeps it until it is collected)
+struct ThreadBufferHandle
+{
+    std::shared_ptr<ProfileBuffer> buffer;
+
+    ~ThreadBufferHandle()
+    {
+        if (buffer)
+        {
+            std::lock_guard<std::mutex> lock(buffer->mutex);
+            buffer->finished = true;
+        }
+    }
+};
+
+thread_local ThreadBufferHandle threadBuffer;
+
+}
+
+/**
+ * @brief Function that returns the singleton
+ * @return              Profiler
+ */
+Profiler& Profiler::getInstance()
+{
+    static Profiler instance;
+    return instance;
+}
+
+/**
+ * @brief Constructor
+ */
+Profiler::Profiler()
+    :   epoch_(std::chrono::steady_clock::now())
+    ,   nextThread_(0)
+    ,   lastFrame_(epoch_)
+    ,   lastAverage_(epoch_)
+    ,   framesSinceAverage_(0)
+    ,   frameTimes_(FRAME_HISTORY, 0.0f)
+    ,   frames_(0)
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+Profiler::~Profiler()
+{
+
+}
+
+/**
+ * @brief Function that returns the buffer of the current thread (created the first time)
+ */
+ProfileBuffer& Profiler::getThreadBuffer()
+{
+    if (!threadBuffer.buffer)
+    {
+        std::shared_ptr<ProfileBuffer> buffer = std::make_shared<ProfileBuffer>();
+        buffer->samples.resize(BUFFER_SIZE);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffer->id = nextThread_++;
+        buffer->threadName = "thread " + std::to_string(buffer->id);
+        buffers_.push_back(buffer);
+        threadBuffer.buffer = buffer;
+    }
+
+    return *threadBuffer.buffer;
+}
+
+/**
+ * @brief Function that returns a time in nanoseconds since the profiler was created
+ * @param time          Time
+ */
+std::int64_t Profiler::getTime(const std::chrono::steady_clock::time_point& time) const
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(time - epoch_).count();
+}
+
+/**
+ * @brief Function that names the current thread in the trace
+ * @param name          Name of the thread
+ */
+void Profiler::I_setThreadName(const std::string& name)
+{
+    ProfileBuffer& buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    buffer.threadName = name;
+}
+
+/**
+ * @brief Function that adds a zone to the buffer of the current thread (the oldest sample is replaced when it is full)
+ * @param name          Name of the zone (string literal)
+ * @param start         Time the zone was entered
+ * @param end           Time the zone was left
+ */
+void Profiler::I_record(const char* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& end)
+{
+    ProfileBuffer& buffer = getThreadBuffer();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+
+    buffer.samples[buffer.written % BUFFER_SIZE] = { name, getTime(start), getTime(end) };
+    ++buffer.written;
+}
+
+/**
+ * @brief Function that ends a frame (main thread) : keeps its duration and adds the new samples of every thread to the zones
+ * The zones are averaged once per second
+ */
+void Profiler::I_endFrame()
+{
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    I_record("Frame", lastFrame_, now);
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    frameTimes_[frames_ % FRAME_HISTORY] = std::chrono::duration<float, std::milli>(now - lastFrame_).count();
+    ++frames_;
+    ++framesSinceAverage_;
+    lastFrame_ = now;
+
+    collect();
+
+    if (now - lastAverage_ < std::chrono::seconds(1))
+        return;
+
+    // The same name can be used by several zones
+    zones_.clear();
+    double frames = static_cast<double>(framesSinceAverage_);
+    for (const auto& total : totals_)
+    {
+        ZoneStats& zone = zones_[total.first];
+        zone.average += static_cast<float>(total.second.total / frames);
+        zone.maximum = std::max(zone.maximum, static_cast<float>(total.second.maximum));
+        zone.calls += static_cast<float>(static_cast<double>(total.second.calls) / frames);
+    }
+
+    totals_.clear();
+    framesSinceAverage_ = 0;
+    lastAverage_ = now;
+}
+
+/**
+ * @brief Function that adds the samples written since the last frame to the zones (called with the mutex locked)
+ * The buffers of the threads that have ended are removed once collected
+ */
+void Profiler::collect()
+{
+    auto buffer = buffers_.begin();
+    while (buffer != buffers_.end())
+    {
+        bool finished = false;
+        {
+            std::lock_guard<std::mutex> lock((*buffer)->mutex);
+            const ProfileBuffer& samples = **buffer;
+
+            // Samples replaced before being collected are lost
+            std::size_t first = std::max(samples.collected, samples.written > BUFFER_SIZE ? samples.written - BUFFER_SIZE : 0);
+            for (std::size_t i = first; i < samples.written; ++i)
+            {
+                const ProfileSample& sample = samples.samples[i % BUFFER_SIZE];
+                double time = static_cast<double>(sample.end - sample.start) / 1e6;
+
+                ZoneTotal& total = totals_[sample.name];
+                total.total += time;
+                total.maximum = std::max(total.maximum, time);
+                ++total.calls;
+            }
+
+            (*buffer)->collected = samples.written;
+            finished = samples.finished;
+        }
+
+        if (finished)
+            buffer = buffers_.erase(buffer);
+        else
+            ++buffer;
+    }
+}
+
+/**
+ * @brief Function that returns the percentiles of the time between two frames (last frames)
+ */
+FramePercentiles Profiler::I_getFramePercentiles() const
+{
+    std::vector<float> times;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        times.assign(frameTimes_.begin(), frameTimes_.begin() + static_cast<std::ptrdiff_t>(std::min(frames_, FRAME_HISTORY)));
+    }
+
+    FramePercentiles percentiles;
+    if (times.empty())
+        return percentiles;
+
+    std::sort(times.begin(), times.end());
+    auto percentile = [&] (double fraction) {
+        return times[static_cast<std::size_t>(fraction * static_cast<double>(times.size() - 1))];
+    };
+
+    percentiles.p50 = percentile(0.50);
+    percentiles.p95 = percentile(0.95);
+    percentiles.p99 = percentile(0.99);
+    return percentiles;
+}
+
+/**
+ * @brief Function that writes the samples kept by every thread in the Chrome trace format
+ * Complete events ("X") with times in microseconds, one track per thread
+ * @param path          Path of the JSON file
+ * @return              Whether the file was written
+ */
+bool Profiler::I_exportChromeTrace(const std::string& path)
+{
+    std::ofstream file(path);
+    if (!file)
+    {
+        std::cout << "Could not write the profile : " << path << std::endl;
+        return false;
+    }
+
+    file << std::fixed << std::setprecision(3) << "{\"traceEvents\":[";
+    const char* separator = "\n";
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const std::shared_ptr<ProfileBuffer>& buffer : buffers_)
+    {
+        std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+
+        file << separator << "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << buffer->id
+             << ",\"args\":{\"name\":\"" << buffer->threadName << "\"}}";
+        separator = ",\n";
+
+        std::size_t first = buffer->written > BUFFER_SIZE ? buffer->written - BUFFER_SIZE : 0;
+        for (std::size_t i = first; i < buffer->written; ++i)
+        {
+            const ProfileSample& sample = buffer->samples[i % BUFFER_SIZE];
+            file << separator << "{\"name\":\"" << sample.name << "\",\"ph\":\"X\",\"pid\":1,\"tid\":" << buffer->id
+                 << ",\"ts\":" << static_cast<double>(sample.start) / 1000.0
+                 << ",\"dur\":" << static_cast<double>(sample.end - sample.start) / 1000.0 << "}";
+        }
+    }
+
+    file << "\n]}" << std::endl;
+    std::cout << "Profile written : " << path << std::endl;
+    return true;
+}
@@ -0,0 +1,200 @@
+#ifndef PROFILER_H
+#define PROFILER_H
+
+// Zone entered and left by a thread (times in nanoseconds since the profiler was created)
+struct ProfileSample
+{
+    const char* name;
+    std::int64_t start;
+    std::int64_t end;
+};
+
+// Samples of a single thread : ring buffer keeping the latest samples
+// Written by its thread, read by the thread ending the frames (the mutex is only contended while collecting)
+struct ProfileBuffer
+{
+    std::string threadName;
+    std::size_t id = 0;                 // Thread id of the trace
+    std::vector<ProfileSample> samples;
+    std::size_t written = 0;            // Samples written since the thread started
+    std::size_t collected = 0;          // Samples already added to the zones
+    bool finished = false;              // The thread has ended
+    std::mutex mutex;
+};
+
+// Time spent in a zone per frame, averaged over the last second (every thread)
+struct ZoneStats
+{
+    float average = 0.0f;               // Time per frame (ms)
+    float maximum = 0.0f;               // Longest call (ms)
+    float calls = 0.0f;                 // Calls per frame
+};
+
+// Time between two frames over the last frames (ms)
+struct FramePercentiles
+{
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+};
+
+// Frame pacing of the render thread measured over the last second (times in milliseconds)
+struct FrameStats
+{
+    std::size_t frames = 0;             // Frames displayed
+    float average = 0.0f;               // Time between two frames displayed
+    float minimum = 0.0f;
+    float maximum = 0.0f;
+    float percentile99 = 0.0f;
+    float simulationWait = 0.0f;        // Time the simulation waited for the render thread
+    float renderWait = 0.0f;            // Time the render thread waited for the simulation
+};
+
+// Singleton class : collects the zones timed by every thread (see ProfileZone)
+// The main thread ends each frame : the new samples are added to the zones and the frame time is kept
+// The latest samples of every thread can be exported as a Chrome trace (chrome://tracing or Perfetto)
+class Profiler
+{
+public:
+
+    static constexpr std::size_t BUFFER_SIZE = 16384;       // Samples kept per thread
+    static constexpr std::size_t FRAME_HISTORY = 600;       // Frames kept for the percentiles
+
+    Profiler(const Profiler&) = delete;
+    void operator=(const Profiler&) = delete;
+
+    static void setThreadName(const std::string& name)
+    {
+        getInstance().I_setThreadName(name);
+    }
+
+    static void record(const char* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& end)
+    {
+        getInstance().I_record(name, start, end);
+    }
+
+    static void endFrame()
+    {
+        getInstance().I_endFrame();
+    }
+
+    static void setCounter(const std::string& name, std::size_t value)
+    {
+        std::lock_guard<std::mutex> lock(getInstance().mutex_);
+        getInstance().counters_[name] = value;
+    }
+
+    // Replaces every counter (counters of the last frame drawn)
+    static void setCounters(const std::map<std::string, std::size_t>& counters)
+    {
+        std::lock_guard<std::mutex> lock(getInstance().mutex_);
+        getInstance().counters_ = counters;
+    }
+
+    static void setFrameStats(const FrameStats& stats)
+    {
+        std::lock_guard<std::mutex> lock(getInstance().mutex_);
+        getInstance().frameStats_ = stats;
+    }
+
+    static std::map<std::string, ZoneStats> getZones()
+    {
+        std::lock_guard<std::mutex> lock(getInstance().mutex_);
+        return getInstance().zones_;
+    }
+
+    static std::map<std::string, std::size_t> getCounters()
+    {
+        std::lock_guard<std::mutex> lock(getInstance().mutex_);
+        return getInstance().counters_;
+    }
+
+    static FrameStats getFrameStats()
+    {
+        std::lock_guard<std::mutex> lock(getInstance().mutex_);
+        return getInstance().frameStats_;
+    }
+
+    static FramePercentiles getFramePercentiles()
+    {
+        return getInstance().I_getFramePercentiles();
+    }
+
+    static bool exportChromeTrace(const std::string& path)
+    {
+        return getInstance().I_exportChromeTrace(path);
+    }
+
+    static Profiler& getInstance();
+    virtual ~Profiler();
+
+private:
+
+    // Time spent in a zone since the zones were last averaged
+    struct ZoneTotal
+    {
+        double total = 0.0;
+        double maximum = 0.0;
+        std::size_t calls = 0;
+    };
+
+    Profiler();
+
+    ProfileBuffer& getThreadBuffer();
+    std::int64_t getTime(const std::chrono::steady_clock::time_point& time) const;
+    void collect();
+
+    void I_setThreadName(const std::string& name);
+    void I_record(const char* name, const std::chrono::steady_clock::time_point& start, const std::chrono::steady_clock::time_point& end);
+    void I_endFrame();
+    FramePercentiles I_getFramePercentiles() const;
+    bool I_exportChromeTrace(const std::string& path);
+
+    const std::chrono::steady_clock::time_point epoch_;
+
+    std::vector<std::shared_ptr<ProfileBuffer>> buffers_;
+    std::size_t nextThread_;
+
+    // Frames ended (main thread)
+    std::chrono::steady_clock::time_point lastFrame_;
+    std::chrono::steady_clock::time_point lastAverage_;
+    std::size_t framesSinceAverage_;
+    std::vector<float> frameTimes_;
+    std::size_t frames_;
+
+    std::map<const char*, ZoneTotal> totals_;       // By literal : no string built per sample
+    std::map<std::string, ZoneStats> zones_;
+    std::map<std::string, std::size_t> counters_;
+    FrameStats frameStats_;
+
+    mutable std::mutex mutex_;
+};
+
+// Times a zone from its creation to the end of the scope
+// ProfileZone zone("Map::update");
+class ProfileZone
+{
+public:
+
+    explicit ProfileZone(const char* name)
+        :   name_(name)
+        ,   start_(std::chrono::steady_clock::now())
+    {
+
+    }
+
+    ~ProfileZone()
+    {
+        Profiler::record(name_, start_, std::chrono::steady_clock::now());
+    }
+
+    ProfileZone(const ProfileZone&) = delete;
+    void operator=(const ProfileZone&) = delete;
+
+private:
+
+    const char* name_;          // String literal : only the pointer is kept
+    std::chrono::steady_clock::time_point start_;
+};
+
+#endif
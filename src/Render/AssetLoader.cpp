@@ -0,0 +1,235 @@
+#include "../headers.h"
+#include "AssetLoader.h"
+#include "../Profiling/Profiler.h"
+
+/**
+ * @brief Constructor
+ */
+AssetLoader::AssetLoader()
+    :   next_(0)
+    ,   uploaded_(0)
+    ,   failed_(false)
+{
+
+}
+
+/**
+ * @brief Destructor (waits for the files being decoded)
+ */
+AssetLoader::~AssetLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        next_ = assets_.size();
+    }
+
+    for (std::thread& worker : workers_)
+    {
+        worker.join();
+    }
+}
+
+/**
+ * @brief Function that adds a texture to load (ignored if already in the cache)
+ * @param path          Path of the image
+ */
+void AssetLoader::addTexture(const std::string& path)
+{
+    if (!ResourceCache::contains(path))
+        assets_.push_back({ TEXTURE, path, sf::Image(), nullptr, {}, {} });
+}
+
+/**
+ * @brief Function that adds a font to load (ignored if already in the cache)
+ * @param path          Path of the font
+ */
+void AssetLoader::addFont(const std::string& path)
+{
+    if (!ResourceCache::contains(path))
+        assets_.push_back({ FONT, path, sf::Image(), nullptr, {}, {} });
+}
+
+/**
+ * @brief Function that adds the atlas to load (ignored if already in the cache)
+ */
+void AssetLoader::addAtlas()
+{
+    if (ResourceCache::hasAtlas())
+        return;
+
+    std::vector<ResourceCache::Sheet> sheets = ResourceCache::getAtlasSheets();
+    assets_.push_back({ ATLAS, ResourceCache::ATLAS_CONFIG, sf::Image(), nullptr, sheets, std::vector<sf::Image>(sheets.size()) });
+}
+
+/**
+ * @brief Function that starts decoding the resources added
+ * @param numberOfWorkers   Number of threads decoding the files
+ */
+void AssetLoader::start(std::size_t numberOfWorkers)
+{
+    numberOfWorkers = std::min(numberOfWorkers, assets_.size());
+    for (std::size_t i = 0; i < numberOfWorkers; ++i)
+    {
+        workers_.emplace_back(&AssetLoader::work, this);
+    }
+}
+
+/**
+ * @brief Function that adds the resources decoded to the cache (main thread : creates the textures)
+ * Stops once the budget is spent : the loading screen keeps being drawn
+ * @param budget        Maximum time spent (ms), at least one resource is uploaded when one is decoded
+ */
+void AssetLoader::upload(float budget)
+{
+    auto start = std::chrono::steady_clock::now();
+    while (true)
+    {
+        std::size_t index;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (failed_)
+                throw("Error : Could not load the assets");
+            if (decoded_.empty())
+                return;
+
+            index = decoded_.back();
+            decoded_.pop_back();
+        }
+
+        create(assets_[index]);
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        ++uploaded_;
+        if (std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count() >= budget)
+            return;
+    }
+}
+
+/**
+ * @brief Function that returns the fraction of the resources loaded (between 0 and 1)
+ */
+float AssetLoader::getProgress() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return assets_.empty() ? 1.0f : static_cast<float>(uploaded_) / static_cast<float>(assets_.size());
+}
+
+/**
+ * @brief Function that returns whether every resource is in the cache
+ */
+bool AssetLoader::isDone() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return uploaded_ == assets_.size();
+}
+
+/**
+ * @brief Function that returns the number of workers used by default (every core but the main one)
+ */
+std::size_t AssetLoader::getDefaultNumberOfWorkers()
+{
+    unsigned int cores = std::thread::hardware_concurrency();
+    return cores > 1 ? cores - 1 : 1;
+}
+
+/**
+ * @brief Function executed by every worker : decodes the next file requested
+ */
+void AssetLoader::work()
+{
+    Profiler::setThreadName("asset loader");
+
+    while (true)
+    {
+        std::size_t index;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (next_ >= assets_.size() || failed_)
+                return;
+
+            index = next_++;
+        }
+
+        // Reading and decoding outside of the lock
+        bool decoded = true;
+        try
+        {
+            decode(assets_[index]);
+        }
+        catch (const char* error)
+        {
+            std::cout << error << " : " << assets_[index].path << "\n";
+            decoded = false;
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (decoded)
+            decoded_.push_back(index);
+        else
+            failed_ = true;
+    }
+}
+
+/**
+ * @brief Function that reads and decodes a file (worker : no texture created)
+ * @param asset         Resource requested
+ */
+void AssetLoader::decode(Asset& asset) const
+{
+    switch (asset.type)
+    {
+        case TEXTURE:
+            if (!asset.image.loadFromFile(asset.path))
+                throw("Error : Could not decode a texture");
+            break;
+        case FONT:
+            asset.font = std::make_shared<sf::Font>();
+            if (!asset.font->loadFromFile(asset.path))
+                throw("Error : Could not load a font");
+            break;
+        case ATLAS:
+            for (std::size_t i = 0; i < asset.sheets.size(); ++i)
+            {
+                if (!asset.sheetImages[i].loadFromFile(asset.sheets[i].second))
+                    throw("Error : Could not decode a sprite sheet of the atlas");
+            }
+            break;
+    }
+}
+
+/**
+ * @brief Function that creates the resource decoded and adds it to the cache (main thread)
+ * @param asset         Resource decoded
+ */
+void AssetLoader::create(Asset& asset) const
+{
+    switch (asset.type)
+    {
+        case TEXTURE:
+        {
+            auto texture = std::make_shared<sf::Texture>();
+            if (!texture->loadFromImage(asset.image))
+                throw("Error : Could not create a texture");
+
+            ResourceCache::addTexture(asset.path, texture);
+            asset.image = sf::Image();
+            break;
+        }
+        case FONT:
+            ResourceCache::addFont(asset.path, asset.font);
+            break;
+        case ATLAS:
+        {
+            auto atlas = std::make_unique<TextureAtlas>();
+            for (std::size_t i = 0; i < asset.sheets.size(); ++i)
+            {
+                atlas->add(asset.sheets[i].first, asset.sheetImages[i]);
+            }
+
+            atlas->pack(ResourceCache::ATLAS_MAX_WIDTH);
+            ResourceCache::setAtlas(std::move(atlas));
+            asset.sheetImages.clear();
+            break;
+        }
+    }
+}
@@ -0,0 +1,64 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include "ResourceCache.h"
+
+// Loads textures, fonts and the atlas in the background
+// Workers read and decode the files, the main thread creates the textures (GPU upload) in slices of limited time
+// Every resource loaded is added to the resource cache
+class AssetLoader
+{
+public:
+
+    static constexpr float DEFAULT_UPLOAD_BUDGET = 4.0f;       // Time spent creating textures per call to upload (ms)
+
+    AssetLoader();
+    virtual ~AssetLoader();
+
+    // Before start
+    void addTexture(const std::string& path);
+    void addFont(const std::string& path);
+    void addAtlas();
+
+    void start(std::size_t numberOfWorkers = getDefaultNumberOfWorkers());
+    void upload(float budget = DEFAULT_UPLOAD_BUDGET);
+
+    // Getters
+    float getProgress() const;
+    bool isDone() const;
+
+    static std::size_t getDefaultNumberOfWorkers();
+
+private:
+
+    enum AssetType
+    {
+        TEXTURE, FONT, ATLAS
+    };
+
+    // Resource requested (decoded by a worker, then uploaded by the main thread)
+    struct Asset
+    {
+        AssetType type;
+        std::string path;
+        sf::Image image;
+        std::shared_ptr<sf::Font> font;
+        std::vector<ResourceCache::Sheet> sheets;       // Atlas only
+        std::vector<sf::Image> sheetImages;
+    };
+
+    void work();
+    void decode(Asset& asset) const;
+    void create(Asset& asset) const;
+
+    std::vector<Asset> assets_;
+    std::size_t next_;                  // Next asset to decode
+    std::vector<std::size_t> decoded_;  // Assets decoded and not uploaded yet
+    std::size_t uploaded_;
+    bool failed_;
+
+    mutable std::mutex mutex_;
+    std::vector<std::thread> workers_;
+};
+
+#endif
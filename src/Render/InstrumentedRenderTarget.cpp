@@ -0,0 +1,153 @@
+#include "../headers.h"
+#include "InstrumentedRenderTarget.h"
+
+const std::string InstrumentedRenderTarget::DEFAULT_SECTION = "other";
+
+/**
+ * @brief Function that adds the counters of another part of the frame
+ * @param counters  Counters added
+ */
+RenderCounters& RenderCounters::operator+=(const RenderCounters& counters)
+{
+    draws += counters.draws;
+    vertices += counters.vertices;
+    textureBinds += counters.textureBinds;
+    stateChanges += counters.stateChanges;
+    return *this;
+}
+
+/**
+ * @brief Constructor
+ * @param target    Where to draw (nullptr : only counts)
+ */
+InstrumentedRenderTarget::InstrumentedRenderTarget(sf::RenderTarget* target)
+    :   target_(target)
+    ,   sections_(1, Section(DEFAULT_SECTION, RenderCounters()))
+    ,   section_(0)
+    ,   texture_(nullptr)
+    ,   bound_(false)
+    ,   viewChanged_(false)
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+InstrumentedRenderTarget::~InstrumentedRenderTarget()
+{
+
+}
+
+/**
+ * @brief Function that counts the next draws in a section
+ * @param name      Name of the section
+ */
+void InstrumentedRenderTarget::beginSection(const std::string& name)
+{
+    for (section_ = 0; section_ < sections_.size(); ++section_)
+    {
+        if (sections_[section_].first == name)
+            return;
+    }
+
+    sections_.emplace_back(name, RenderCounters());
+}
+
+/**
+ * @brief Function that changes the view (applied by the next draw)
+ * @param view      View
+ */
+void InstrumentedRenderTarget::setView(const sf::View& view)
+{
+    viewChanged_ = true;
+    if (target_)
+        target_->setView(view);
+}
+
+/**
+ * @brief Function that draws a sprite : one quad
+ * @param sprite    Sprite
+ */
+void InstrumentedRenderTarget::draw(const sf::Sprite& sprite)
+{
+    addDraw(4, sprite.getTexture());
+    if (target_)
+        target_->draw(sprite);
+}
+
+/**
+ * @brief Function that draws a rectangle : a triangle fan, then a strip without texture for the outline
+ * @param shape     Rectangle
+ */
+void InstrumentedRenderTarget::draw(const sf::RectangleShape& shape)
+{
+    addDraw(shape.getPointCount() + 2, shape.getTexture());
+    if (shape.getOutlineThickness() != 0.0f)
+        addDraw((shape.getPointCount() + 1) * 2, nullptr);
+
+    if (target_)
+        target_->draw(shape);
+}
+
+/**
+ * @brief Function that draws vertices
+ * @param vertices  First vertex
+ * @param count     Number of vertices
+ * @param primitive Primitive drawn with the vertices
+ * @param texture   Texture of the vertices
+ */
+void InstrumentedRenderTarget::draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType primitive, const sf::Texture* texture)
+{
+    addDraw(count, texture);
+    if (target_)
+        target_->draw(vertices, count, primitive, sf::RenderStates(texture));
+}
+
+/**
+ * @brief Function that returns the counters of every section drawn
+ */
+const std::vector<InstrumentedRenderTarget::Section>& InstrumentedRenderTarget::getSections() const
+{
+    return sections_;
+}
+
+/**
+ * @brief Function that returns the counters of the whole frame
+ */
+RenderCounters InstrumentedRenderTarget::getTotal() const
+{
+    RenderCounters total;
+    for (const Section& section : sections_)
+    {
+        total += section.second;
+    }
+
+    return total;
+}
+
+/**
+ * @brief Function that counts a draw call in the current section
+ * @param vertices  Number of vertices
+ * @param texture   Texture used by the draw
+ */
+void InstrumentedRenderTarget::addDraw(std::size_t vertices, const sf::Texture* texture)
+{
+    RenderCounters& counters = sections_[section_].second;
+    ++counters.draws;
+    counters.vertices += vertices;
+
+    if (!bound_ || texture != texture_)
+    {
+        ++counters.textureBinds;
+        ++counters.stateChanges;
+        texture_ = texture;
+        bound_ = true;
+    }
+
+    if (viewChanged_)
+    {
+        ++counters.stateChanges;
+        viewChanged_ = false;
+    }
+}
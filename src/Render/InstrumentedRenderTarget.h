@@ -0,0 +1,58 @@
+#ifndef INSTRUMENTED_RENDER_TARGET_H
+#define INSTRUMENTED_RENDER_TARGET_H
+
+#include "SFML/Graphics.hpp"
+
+// Work submitted to the GPU by a part of the frame
+struct RenderCounters
+{
+    std::size_t draws = 0;              // Draw calls
+    std::size_t vertices = 0;           // Vertices submitted (same geometry as SFML)
+    std::size_t textureBinds = 0;       // Draws with another texture than the previous one
+    std::size_t stateChanges = 0;       // Texture binds and views applied (no shaders or blend modes in the game)
+
+    RenderCounters& operator+=(const RenderCounters& counters);
+};
+
+// Render target counting what each section of the frame submits (see RenderSnapshot::beginSection)
+// Draws are forwarded to the target, without target only the counters are updated (no OpenGL context needed)
+// Like SFML, a texture is bound only when it changes and a view is applied by the next draw
+class InstrumentedRenderTarget
+{
+public:
+
+    static const std::string DEFAULT_SECTION;      // Drawn before the first section
+
+    // Section of the frame and its counters
+    typedef std::pair<std::string, RenderCounters> Section;
+
+    InstrumentedRenderTarget(sf::RenderTarget* target = nullptr);
+    virtual ~InstrumentedRenderTarget();
+
+    void beginSection(const std::string& name);
+
+    // Same calls as a sf::RenderTarget
+    void setView(const sf::View& view);
+    void draw(const sf::Sprite& sprite);
+    void draw(const sf::RectangleShape& shape);
+    void draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType primitive, const sf::Texture* texture = nullptr);
+
+    // Getters
+    const std::vector<Section>& getSections() const;
+    RenderCounters getTotal() const;
+
+private:
+
+    void addDraw(std::size_t vertices, const sf::Texture* texture);
+
+    sf::RenderTarget* target_;
+
+    std::vector<Section> sections_;         // In the order they were first drawn (a section can be drawn several times)
+    std::size_t section_;                   // Section drawn
+
+    const sf::Texture* texture_;            // Texture of the previous draw
+    bool bound_;                            // Whether a texture (or none) was bound
+    bool viewChanged_;
+};
+
+#endif
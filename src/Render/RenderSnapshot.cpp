@@ -0,0 +1,281 @@
+#include "../headers.h"
+#include "RenderSnapshot.h"
+
+/**
+ * @brief Constructor
+ */
+RenderSnapshot::RenderSnapshot()
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+RenderSnapshot::~RenderSnapshot()
+{
+
+}
+
+/**
+ * @brief Function that removes everything recorded (before recording a new frame)
+ */
+void RenderSnapshot::clear()
+{
+    commands_.clear();
+    views_.clear();
+    sections_.clear();
+    sprites_.clear();
+    shapes_.clear();
+    vertices_.clear();
+    batch_.clear();
+}
+
+/**
+ * @brief Function that records a change of view (used by the next drawables)
+ * @param view      View
+ */
+void RenderSnapshot::setView(const sf::View& view)
+{
+    commands_.push_back({ VIEW, views_.size(), 0, sf::Points, nullptr });
+    views_.push_back(view);
+}
+
+/**
+ * @brief Function that records the start of a part of the frame (the next drawables are counted in it)
+ * @param name      Name of the section
+ */
+void RenderSnapshot::beginSection(const std::string& name)
+{
+    commands_.push_back({ SECTION, sections_.size(), 0, sf::Points, nullptr });
+    sections_.push_back(name);
+}
+
+/**
+ * @brief Function that records a sprite
+ * @param sprite    Sprite (position, texture rectangle and color copied)
+ */
+void RenderSnapshot::draw(const sf::Sprite& sprite)
+{
+    commands_.push_back({ SPRITE, sprites_.size(), 0, sf::Points, nullptr });
+    sprites_.push_back(sprite);
+}
+
+/**
+ * @brief Function that records a text as the quads of its glyphs (outline under the characters, like SFML)
+ * The glyphs are laid out here : sf::Font is not thread-safe and the simulation keeps loading glyphs in it,
+ * the render thread only draws vertices with the texture of the font
+ * @param text      Text
+ */
+void RenderSnapshot::draw(const sf::Text& text)
+{
+    const sf::Font* font = text.getFont();
+    if (font == nullptr || text.getString().isEmpty())
+        return;
+
+    std::size_t start = vertices_.size();
+    if (text.getOutlineThickness() != 0.0f)
+        addGlyphs(text, text.getOutlineThickness(), text.getOutlineColor());
+    addGlyphs(text, 0.0f, text.getFillColor());
+
+    // Only spaces : nothing drawn
+    if (vertices_.size() == start)
+        return;
+
+    // After the layout : the glyphs loaded by the text are in the texture
+    commands_.push_back({ VERTICES, start, vertices_.size() - start, sf::Triangles, &font->getTexture(text.getCharacterSize()) });
+}
+
+/**
+ * @brief Function that records a rectangle
+ * @param shape     Rectangle
+ */
+void RenderSnapshot::draw(const sf::RectangleShape& shape)
+{
+    commands_.push_back({ SHAPE, shapes_.size(), 0, sf::Points, nullptr });
+    shapes_.push_back(shape);
+}
+
+/**
+ * @brief Function that records a vertex array (layer of a chunk)
+ * @param vertices  Vertices (copied in a buffer shared by every array of the frame)
+ * @param texture   Texture of the vertices
+ */
+void RenderSnapshot::draw(const sf::VertexArray& vertices, const sf::Texture* texture)
+{
+    if (vertices.getVertexCount() == 0)
+        return;
+
+    draw(&vertices[0], vertices.getVertexCount(), vertices.getPrimitiveType(), texture);
+}
+
+/**
+ * @brief Function that records vertices
+ * @param vertices  First vertex (copied in a buffer shared by every array of the frame)
+ * @param count     Number of vertices
+ * @param primitive Primitive drawn with the vertices
+ * @param texture   Texture of the vertices
+ */
+void RenderSnapshot::draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType primitive, const sf::Texture* texture)
+{
+    if (count == 0)
+        return;
+
+    commands_.push_back({ VERTICES, vertices_.size(), count, primitive, texture });
+    vertices_.insert(vertices_.end(), vertices, vertices + count);
+}
+
+/**
+ * @brief Function that returns the batch collecting the sprites of the frame
+ */
+SpriteBatch& RenderSnapshot::getBatch()
+{
+    return batch_;
+}
+
+/**
+ * @brief Function that records the sprites collected by the batch (one draw per texture)
+ */
+void RenderSnapshot::flushBatch()
+{
+    batch_.flush(*this);
+}
+
+/**
+ * @brief Function that adds two triangles per visible character of a text, at their position in the world
+ * Same layout as sf::Text (kerning, letter and line spacing, bold), italic and underline are not used by the game
+ * @param text      Text
+ * @param thickness Thickness of the outline (0 : characters)
+ * @param color     Color of the quads
+ */
+void RenderSnapshot::addGlyphs(const sf::Text& text, float thickness, const sf::Color& color)
+{
+    const sf::Font& font = *text.getFont();
+    const sf::String& string = text.getString();
+    const sf::Transform& transform = text.getTransform();
+    unsigned int size = text.getCharacterSize();
+    bool bold = (text.getStyle() & sf::Text::Bold) != 0;
+
+    float whitespace = font.getGlyph(' ', size, bold).advance;
+    float letterSpacing = (whitespace / 3.0f) * (text.getLetterSpacing() - 1.0f);
+    whitespace += letterSpacing;
+    float lineSpacing = font.getLineSpacing(size) * text.getLineSpacing();
+
+    sf::Vector2f position(0.0f, static_cast<float>(size));
+    sf::Uint32 previous = 0;
+    for (std::size_t i = 0; i < string.getSize(); ++i)
+    {
+        sf::Uint32 character = string[i];
+        if (character == '\r')
+            continue;
+
+        position.x += font.getKerning(previous, character, size);
+        previous = character;
+
+        if (character == ' ' || character == '\t')
+        {
+            position.x += character == ' ' ? whitespace : 4.0f * whitespace;
+            continue;
+        }
+        if (character == '\n')
+        {
+            position.x = 0.0f;
+            position.y += lineSpacing;
+            continue;
+        }
+
+        // Same padding as SFML : the edges of the glyph are not cut by the filtering
+        const sf::Glyph& glyph = font.getGlyph(character, size, bold, thickness);
+        float left = position.x + glyph.bounds.left - 1.0f;
+        float top = position.y + glyph.bounds.top - 1.0f;
+        float right = position.x + glyph.bounds.left + glyph.bounds.width + 1.0f;
+        float bottom = position.y + glyph.bounds.top + glyph.bounds.height + 1.0f;
+
+        float u1 = static_cast<float>(glyph.textureRect.left) - 1.0f;
+        float v1 = static_cast<float>(glyph.textureRect.top) - 1.0f;
+        float u2 = static_cast<float>(glyph.textureRect.left + glyph.textureRect.width) + 1.0f;
+        float v2 = static_cast<float>(glyph.textureRect.top + glyph.textureRect.height) + 1.0f;
+
+        sf::Vertex topLeft(transform.transformPoint(left, top), color, sf::Vector2f(u1, v1));
+        sf::Vertex topRight(transform.transformPoint(right, top), color, sf::Vector2f(u2, v1));
+        sf::Vertex bottomLeft(transform.transformPoint(left, bottom), color, sf::Vector2f(u1, v2));
+        sf::Vertex bottomRight(transform.transformPoint(right, bottom), color, sf::Vector2f(u2, v2));
+        vertices_.insert(vertices_.end(), { topLeft, topRight, bottomLeft, bottomLeft, topRight, bottomRight });
+
+        // The outline does not change the advance
+        position.x += font.getGlyph(character, size, bold).advance + letterSpacing;
+    }
+}
+
+/**
+ * @brief Function that draws everything recorded, in the same order
+ * @param target    Where to draw (render thread only)
+ */
+void RenderSnapshot::replay(sf::RenderTarget& target) const
+{
+    InstrumentedRenderTarget instrumented(&target);
+    replay(instrumented);
+}
+
+/**
+ * @brief Function that draws everything recorded and counts what each section submits
+ * @param target    Where to draw (render thread only, or only counts)
+ */
+void RenderSnapshot::replay(InstrumentedRenderTarget& target) const
+{
+    for (const Command& command : commands_)
+    {
+        switch (command.type)
+        {
+            case VIEW:
+                target.setView(views_[command.index]);
+                break;
+            case SECTION:
+                target.beginSection(sections_[command.index]);
+                break;
+            case SPRITE:
+                target.draw(sprites_[command.index]);
+                break;
+            case SHAPE:
+                target.draw(shapes_[command.index]);
+                break;
+            case VERTICES:
+                target.draw(&vertices_[command.index], command.count, command.primitive, command.texture);
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Function that returns the number of commands recorded
+ */
+std::size_t RenderSnapshot::getCommandCount() const
+{
+    return commands_.size();
+}
+
+/**
+ * @brief Function that returns the number of draw calls made by replay
+ */
+std::size_t RenderSnapshot::getDrawCount() const
+{
+    return getCounters().draws;
+}
+
+/**
+ * @brief Function that returns the number of vertices submitted by replay
+ */
+std::size_t RenderSnapshot::getVertexCount() const
+{
+    return getCounters().vertices;
+}
+
+/**
+ * @brief Function that returns what replay submits for the whole frame (counted without drawing)
+ */
+RenderCounters RenderSnapshot::getCounters() const
+{
+    InstrumentedRenderTarget counter;
+    replay(counter);
+    return counter.getTotal();
+}
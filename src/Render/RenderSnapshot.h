@@ -0,0 +1,74 @@
+#ifndef RENDER_SNAPSHOT_H
+#define RENDER_SNAPSHOT_H
+
+#include "SFML/Graphics.hpp"
+#include "SpriteBatch.h"
+#include "InstrumentedRenderTarget.h"
+
+// Everything drawn during a frame, recorded by the simulation and drawn later by the render thread
+// Drawables are copied : the simulation can change them as soon as they are recorded (texts are recorded as vertices)
+// The textures and fonts are not copied, they must live until the snapshot is drawn (see RenderThread::flush)
+class RenderSnapshot
+{
+public:
+
+    RenderSnapshot();
+    virtual ~RenderSnapshot();
+
+    void clear();
+
+    // Part of the frame counted separately by an instrumented target (map, entities, HUD, ...)
+    void beginSection(const std::string& name);
+
+    // Same calls as a sf::RenderTarget
+    void setView(const sf::View& view);
+    void draw(const sf::Sprite& sprite);
+    void draw(const sf::Text& text);
+    void draw(const sf::RectangleShape& shape);
+    void draw(const sf::VertexArray& vertices, const sf::Texture* texture = nullptr);
+    void draw(const sf::Vertex* vertices, std::size_t count, sf::PrimitiveType primitive, const sf::Texture* texture = nullptr);
+
+    // Sprites of the frame, recorded together by flushBatch
+    SpriteBatch& getBatch();
+    void flushBatch();
+
+    void replay(sf::RenderTarget& target) const;
+    void replay(InstrumentedRenderTarget& target) const;
+
+    // Getters
+    std::size_t getCommandCount() const;
+    std::size_t getDrawCount() const;
+    std::size_t getVertexCount() const;
+    RenderCounters getCounters() const;
+
+private:
+
+    void addGlyphs(const sf::Text& text, float thickness, const sf::Color& color);
+
+    enum CommandType
+    {
+        VIEW, SECTION, SPRITE, SHAPE, VERTICES
+    };
+
+    // Drawable recorded (index in the list of its type)
+    struct Command
+    {
+        CommandType type;
+        std::size_t index;
+        std::size_t count;                  // Vertices only
+        sf::PrimitiveType primitive;        // Vertices only
+        const sf::Texture* texture;         // Vertices only
+    };
+
+    // Every list keeps its memory from one frame to the next
+    std::vector<Command> commands_;
+    std::vector<sf::View> views_;
+    std::vector<std::string> sections_;
+    std::vector<sf::Sprite> sprites_;
+    std::vector<sf::RectangleShape> shapes_;
+    std::vector<sf::Vertex> vertices_;
+
+    SpriteBatch batch_;
+};
+
+#endif
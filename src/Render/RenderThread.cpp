@@ -0,0 +1,187 @@
+#include "../headers.h"
+#include "RenderThread.h"
+
+/**
+ * @brief Constructor (starts the thread)
+ * @param window    Window drawn by the thread (its context is given to the thread)
+ */
+RenderThread::RenderThread(sf::RenderWindow& window)
+    :   window_(window)
+    ,   recorded_(0)
+    ,   ready_(1)
+    ,   drawn_(2)
+    ,   hasReady_(false)
+    ,   drawing_(false)
+    ,   running_(true)
+    ,   simulationWait_(0.0f)
+    ,   renderWait_(0.0f)
+{
+    for (auto& snapshot : snapshots_)
+        snapshot = std::make_shared<RenderSnapshot>();
+
+    // A context can only be active in one thread
+    window_.setActive(false);
+    thread_ = std::thread(&RenderThread::run, this);
+}
+
+/**
+ * @brief Destructor (stops the thread once the frame drawn is displayed)
+ */
+RenderThread::~RenderThread()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        running_ = false;
+    }
+    condition_.notify_all();
+    thread_.join();
+}
+
+/**
+ * @brief Function that returns the snapshot to record the next frame in (cleared)
+ */
+std::shared_ptr<RenderSnapshot> RenderThread::beginFrame()
+{
+    // Only the simulation uses this snapshot until it is published
+    snapshots_[recorded_]->clear();
+    return snapshots_[recorded_];
+}
+
+/**
+ * @brief Function that gives the frame recorded to the render thread
+ * Waits while the previous frame published has not been taken : the simulation is at most one frame ahead
+ */
+void RenderThread::publish()
+{
+    auto start = std::chrono::steady_clock::now();
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        condition_.wait(lock, [this]() { return !hasReady_ || !running_; });
+
+        std::swap(recorded_, ready_);
+        hasReady_ = true;
+        simulationWait_ += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+    }
+    condition_.notify_all();
+}
+
+/**
+ * @brief Function that drops the frame waiting and waits for the frame drawn
+ * To call before destroying textures or fonts that the snapshots could use
+ */
+void RenderThread::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    hasReady_ = false;
+    condition_.wait(lock, [this]() { return !drawing_; });
+}
+
+/**
+ * @brief Function that returns the frame pacing of the last second
+ */
+FrameStats RenderThread::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
+
+/**
+ * @brief Function executed by the thread : draws and displays every snapshot published
+ */
+void RenderThread::run()
+{
+    window_.setActive(true);
+    Profiler::setThreadName("render");
+
+    auto lastFrame = std::chrono::steady_clock::now();
+    while (true)
+    {
+        auto start = std::chrono::steady_clock::now();
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            condition_.wait(lock, [this]() { return hasReady_ || !running_; });
+
+            if (!running_)
+                break;
+
+            std::swap(ready_, drawn_);
+            hasReady_ = false;
+            drawing_ = true;
+            renderWait_ += std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - start).count();
+        }
+        condition_.notify_all();
+
+        InstrumentedRenderTarget target(&window_);
+        {
+            ProfileZone zone("RenderSnapshot::replay");
+            window_.clear();
+            snapshots_[drawn_]->replay(target);
+        }
+        window_.display();
+        publishCounters(target);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            drawing_ = false;
+
+            auto now = std::chrono::steady_clock::now();
+            addFrame(std::chrono::duration<float, std::milli>(now - lastFrame).count());
+            lastFrame = now;
+        }
+        condition_.notify_all();
+    }
+
+    window_.setActive(false);
+}
+
+/**
+ * @brief Function that gives what each section of the frame drawn submitted to the profiler (see ProfilerOverlay)
+ * @param target    Target that drew the frame
+ */
+void RenderThread::publishCounters(const InstrumentedRenderTarget& target) const
+{
+    std::map<std::string, std::size_t> counters;
+    auto add = [&] (const std::string& name, const RenderCounters& section) {
+        counters[name + "/draws"] = section.draws;
+        counters[name + "/vertices"] = section.vertices;
+        counters[name + "/binds"] = section.textureBinds;
+        counters[name + "/states"] = section.stateChanges;
+    };
+
+    for (const InstrumentedRenderTarget::Section& section : target.getSections())
+    {
+        if (section.second.draws > 0)
+            add(section.first, section.second);
+    }
+    add("frame", target.getTotal());
+
+    Profiler::setCounters(counters);
+}
+
+/**
+ * @brief Function that adds the time of a frame displayed to the stats (called with the mutex locked)
+ * @param time      Time since the previous frame displayed (ms)
+ */
+void RenderThread::addFrame(float time)
+{
+    frameTimes_.push_back(time);
+
+    float total = std::accumulate(frameTimes_.begin(), frameTimes_.end(), 0.0f);
+    if (total < 1000.0f)
+        return;
+
+    // One second measured : new stats
+    std::sort(frameTimes_.begin(), frameTimes_.end());
+    stats_.frames = frameTimes_.size();
+    stats_.average = total / static_cast<float>(frameTimes_.size());
+    stats_.minimum = frameTimes_.front();
+    stats_.maximum = frameTimes_.back();
+    stats_.percentile99 = frameTimes_[(frameTimes_.size() - 1) * 99 / 100];
+    stats_.simulationWait = simulationWait_;
+    stats_.renderWait = renderWait_;
+    Profiler::setFrameStats(stats_);
+
+    frameTimes_.clear();
+    simulationWait_ = 0.0f;
+    renderWait_ = 0.0f;
+}
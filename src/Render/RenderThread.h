@@ -0,0 +1,54 @@
+#ifndef RENDER_THREAD_H
+#define RENDER_THREAD_H
+
+#include "RenderSnapshot.h"
+#include "../Profiling/Profiler.h"
+
+// Thread drawing the snapshots recorded by the simulation (owns the context of the window while running)
+// Three snapshots : one recorded by the simulation, one ready, one drawn
+// The simulation can record the next frame while the previous one is drawn and displayed
+class RenderThread
+{
+public:
+
+    static constexpr std::size_t BUFFERS = 3;
+
+    RenderThread(sf::RenderWindow& window);
+    virtual ~RenderThread();
+
+    // Simulation thread
+    std::shared_ptr<RenderSnapshot> beginFrame();
+    void publish();
+    void flush();
+
+    // Getters
+    FrameStats getStats() const;
+
+private:
+
+    void run();
+    void publishCounters(const InstrumentedRenderTarget& target) const;
+    void addFrame(float time);
+
+    sf::RenderWindow& window_;
+
+    std::array<std::shared_ptr<RenderSnapshot>, BUFFERS> snapshots_;
+    std::size_t recorded_;              // Snapshot recorded by the simulation
+    std::size_t ready_;                 // Last snapshot published
+    std::size_t drawn_;                 // Snapshot drawn by the render thread
+    bool hasReady_;
+    bool drawing_;
+    bool running_;
+
+    // Frame pacing (every frame of the current second, stats of the last one)
+    std::vector<float> frameTimes_;
+    float simulationWait_;
+    float renderWait_;
+    FrameStats stats_;
+
+    mutable std::mutex mutex_;
+    std::condition_variable condition_;
+    std::thread thread_;
+};
+
+#endif
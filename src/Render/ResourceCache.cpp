@@ -0,0 +1,131 @@
+#include "../headers.h"
+#include "ResourceCache.h"
+
+const std::string ResourceCache::ATLAS_CONFIG = "config/atlas.ini";
+
+/**
+ * @brief Function that returns the singleton
+ * @return              Resource cache
+ */
+ResourceCache& ResourceCache::getInstance()
+{
+    static ResourceCache instance;
+    return instance;
+}
+
+/**
+ * @brief Constructor
+ */
+ResourceCache::ResourceCache()
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+ResourceCache::~ResourceCache()
+{
+
+}
+
+/**
+ * @brief Function that returns the sprite sheets packed in the atlas
+ * Format of a line : name path
+ */
+std::vector<ResourceCache::Sheet> ResourceCache::getAtlasSheets()
+{
+    std::ifstream file(ATLAS_CONFIG);
+    std::vector<Sheet> sheets;
+    std::string name, path;
+
+    while (file >> name >> path)
+    {
+        sheets.emplace_back(name, path);
+    }
+
+    return sheets;
+}
+
+/**
+ * @brief Function that packs the sprite sheets in the atlas
+ */
+void ResourceCache::loadAtlas()
+{
+    atlas_ = std::make_unique<TextureAtlas>();
+    sf::Image image;
+
+    for (const Sheet& sheet : getAtlasSheets())
+    {
+        if (!image.loadFromFile(sheet.second))
+            throw("Error : Could not load a sprite sheet of the atlas");
+
+        atlas_->add(sheet.first, image);
+    }
+
+    atlas_->pack(ATLAS_MAX_WIDTH);
+}
+
+/**
+ * @brief Function that returns a texture, loaded the first time
+ * @param path          Path of the image
+ */
+std::shared_ptr<sf::Texture> ResourceCache::I_getTexture(const std::string& path)
+{
+    std::shared_ptr<sf::Texture>& texture = textures_[path];
+    if (texture == nullptr)
+    {
+        texture = std::make_shared<sf::Texture>();
+        if (!texture->loadFromFile(path))
+        {
+            textures_.erase(path);
+            std::cout << "Texture : " << path << "\n";
+            throw("Error : Could not load a texture");
+        }
+    }
+
+    return texture;
+}
+
+/**
+ * @brief Function that returns a font, loaded the first time
+ * @param path          Path of the font
+ */
+std::shared_ptr<sf::Font> ResourceCache::I_getFont(const std::string& path)
+{
+    std::shared_ptr<sf::Font>& font = fonts_[path];
+    if (font == nullptr)
+    {
+        font = std::make_shared<sf::Font>();
+        if (!font->loadFromFile(path))
+        {
+            fonts_.erase(path);
+            std::cout << "Font : " << path << "\n";
+            throw("Error : Could not load a font");
+        }
+    }
+
+    return font;
+}
+
+/**
+ * @brief Function that returns a sprite sheet (the atlas and the rectangle of the sheet in it)
+ * @param name          Name of the sprite sheet @see atlas.ini
+ */
+TextureRegion ResourceCache::I_getSheet(const std::string& name)
+{
+    if (atlas_ == nullptr)
+        loadAtlas();
+
+    return TextureRegion { atlas_->getTexture(), atlas_->getRect(name) };
+}
+
+/**
+ * @brief Function that releases the textures held by the cache (the ones still used are kept by their users)
+ */
+void ResourceCache::I_clear()
+{
+    textures_.clear();
+    fonts_.clear();
+    atlas_.reset();
+}
@@ -0,0 +1,91 @@
+#ifndef RESOURCE_CACHE_H
+#define RESOURCE_CACHE_H
+
+#include "TextureAtlas.h"
+
+// Singleton class : every texture and font is loaded once and shared
+// The sprite sheets listed in atlas.ini are packed together in one atlas the first time one of them is needed
+// Resources can also be loaded in the background (see AssetLoader) and added once ready
+class ResourceCache
+{
+public:
+
+    static constexpr unsigned int ATLAS_MAX_WIDTH = 2048;
+    static const std::string ATLAS_CONFIG;
+
+    // Name and path of a sprite sheet of the atlas
+    typedef std::pair<std::string, std::string> Sheet;
+
+    ResourceCache(const ResourceCache&) = delete;
+    void operator=(const ResourceCache&) = delete;
+
+    static std::shared_ptr<sf::Texture> getTexture(const std::string& path)
+    {
+        return getInstance().I_getTexture(path);
+    }
+
+    static std::shared_ptr<sf::Font> getFont(const std::string& path)
+    {
+        return getInstance().I_getFont(path);
+    }
+
+    static TextureRegion getSheet(const std::string& name)
+    {
+        return getInstance().I_getSheet(name);
+    }
+
+    static std::vector<Sheet> getAtlasSheets();
+
+    // Resources loaded in the background
+    static void addTexture(const std::string& path, std::shared_ptr<sf::Texture> texture)
+    {
+        getInstance().textures_[path] = texture;
+    }
+
+    static void addFont(const std::string& path, std::shared_ptr<sf::Font> font)
+    {
+        getInstance().fonts_[path] = font;
+    }
+
+    static void setAtlas(std::unique_ptr<TextureAtlas> atlas)
+    {
+        getInstance().atlas_ = std::move(atlas);
+    }
+
+    static bool contains(const std::string& path)
+    {
+        return getInstance().textures_.count(path) > 0 || getInstance().fonts_.count(path) > 0;
+    }
+
+    static bool hasAtlas()
+    {
+        return getInstance().atlas_ != nullptr;
+    }
+
+    static void clear()
+    {
+        getInstance().I_clear();
+    }
+
+    static ResourceCache& getInstance();
+    virtual ~ResourceCache();
+
+private:
+
+    ResourceCache();
+
+    void loadAtlas();
+    std::shared_ptr<sf::Texture> I_getTexture(const std::string& path);
+    std::shared_ptr<sf::Font> I_getFont(const std::string& path);
+    TextureRegion I_getSheet(const std::string& name);
+    void I_clear();
+
+    // Textures and fonts by path
+    std::unordered_map<std::string, std::shared_ptr<sf::Texture>> textures_;
+    std::unordered_map<std::string, std::shared_ptr<sf::Font>> fonts_;
+
+    // Sprite sheets by name (null until one is needed)
+    std::unique_ptr<TextureAtlas> atlas_;
+};
+
+#endif
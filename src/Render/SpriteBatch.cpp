@@ -0,0 +1,212 @@
+#include "../headers.h"
+#include "SpriteBatch.h"
+#include "RenderSnapshot.h"
+
+/**
+ * @brief Constructor
+ */
+SpriteBatch::SpriteBatch()
+    :   debugDrawing_(false)
+    ,   drawCount_(0)
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+SpriteBatch::~SpriteBatch()
+{
+
+}
+
+/**
+ * @brief Function that removes every quad and outline added
+ */
+void SpriteBatch::clear()
+{
+    quads_.clear();
+    quadVertices_.clear();
+    lines_.clear();
+}
+
+/**
+ * @brief Function that records the quads (sorted) and the outlines in a snapshot, then clears the batch
+ * @param target        Snapshot of the frame
+ */
+void SpriteBatch::flush(RenderSnapshot& target)
+{
+    drawCount_ = 0;
+
+    std::sort(quads_.begin(), quads_.end(), [](const Quad& a, const Quad& b) {
+        if (a.layer != b.layer)
+            return a.layer < b.layer;
+        if (a.depth != b.depth)
+            return a.depth < b.depth;
+        return a.first < b.first;
+    });
+
+    vertices_.clear();
+    std::size_t start = 0;
+    for (std::size_t i = 0; i < quads_.size(); ++i)
+    {
+        const Quad& quad = quads_[i];
+        vertices_.insert(vertices_.end(), &quadVertices_[quad.first], &quadVertices_[quad.first] + 4);
+
+        // End of a run of quads with the same texture
+        if (i + 1 == quads_.size() || quads_[i + 1].texture != quad.texture)
+        {
+            target.draw(&vertices_[start], vertices_.size() - start, sf::Quads, quad.texture);
+            start = vertices_.size();
+            ++drawCount_;
+        }
+    }
+
+    if (!lines_.empty())
+    {
+        target.draw(lines_.data(), lines_.size(), sf::Lines);
+        ++drawCount_;
+    }
+
+    clear();
+}
+
+/**
+ * @brief Function that adds a sprite (its depth is the bottom of the sprite)
+ * @param sprite        Sprite (texture, texture rectangle, transform and color)
+ * @param layer         Layer
+ */
+void SpriteBatch::draw(const sf::Sprite& sprite, Layer layer)
+{
+    sf::FloatRect bounds = sprite.getGlobalBounds();
+    draw(sprite, layer, bounds.top + bounds.height);
+}
+
+/**
+ * @brief Function that adds a sprite
+ * @param sprite        Sprite (texture, texture rectangle, transform and color)
+ * @param layer         Layer
+ * @param depth         Order in the layer
+ */
+void SpriteBatch::draw(const sf::Sprite& sprite, Layer layer, float depth)
+{
+    if (sprite.getTexture() == nullptr)
+        return;
+
+    sf::FloatRect bounds = sprite.getLocalBounds();
+    const sf::Transform& transform = sprite.getTransform();
+    sf::Vector2f corners[4] = {
+        transform.transformPoint(0.0f, 0.0f),
+        transform.transformPoint(bounds.width, 0.0f),
+        transform.transformPoint(bounds.width, bounds.height),
+        transform.transformPoint(0.0f, bounds.height)
+    };
+
+    addQuad(sprite.getTexture(), corners, sprite.getTextureRect(), sprite.getColor(), layer, depth);
+}
+
+/**
+ * @brief Function that adds a frame of a texture sheet (without transform, its depth is its bottom)
+ * @param texture       Texture sheet
+ * @param textureRect   Frame in the texture sheet
+ * @param position      Top left corner
+ * @param color         Color multiplied with the texture
+ * @param layer         Layer
+ */
+void SpriteBatch::draw(const sf::Texture* texture, const sf::IntRect& textureRect, const sf::Vector2f& position,
+        const sf::Color& color, Layer layer)
+{
+    if (texture == nullptr)
+        return;
+
+    sf::Vector2f size(static_cast<float>(std::abs(textureRect.width)), static_cast<float>(std::abs(textureRect.height)));
+    sf::Vector2f corners[4] = {
+        position,
+        sf::Vector2f(position.x + size.x, position.y),
+        position + size,
+        sf::Vector2f(position.x, position.y + size.y)
+    };
+
+    addQuad(texture, corners, textureRect, color, layer, position.y + size.y);
+}
+
+/**
+ * @brief Function that adds the outline of a rectangle (ignored while debug drawing is off)
+ * @param rect          Rectangle (hitbox)
+ * @param color         Color of the outline
+ */
+void SpriteBatch::drawOutline(const sf::FloatRect& rect, const sf::Color& color)
+{
+    if (!debugDrawing_)
+        return;
+
+    sf::Vector2f corners[4] = {
+        sf::Vector2f(rect.left, rect.top),
+        sf::Vector2f(rect.left + rect.width, rect.top),
+        sf::Vector2f(rect.left + rect.width, rect.top + rect.height),
+        sf::Vector2f(rect.left, rect.top + rect.height)
+    };
+
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        lines_.emplace_back(corners[i], color);
+        lines_.emplace_back(corners[(i + 1) % 4], color);
+    }
+}
+
+/**
+ * @brief Function that adds the vertices of a quad
+ * @param texture       Texture
+ * @param corners       Corners (top left, top right, bottom right, bottom left)
+ * @param textureRect   Rectangle of the quad in the texture
+ * @param color         Color multiplied with the texture
+ * @param layer         Layer
+ * @param depth         Order in the layer
+ */
+void SpriteBatch::addQuad(const sf::Texture* texture, const sf::Vector2f* corners, const sf::IntRect& textureRect,
+        const sf::Color& color, Layer layer, float depth)
+{
+    float left = static_cast<float>(textureRect.left);
+    float top = static_cast<float>(textureRect.top);
+    float right = left + static_cast<float>(textureRect.width);
+    float bottom = top + static_cast<float>(textureRect.height);
+
+    quads_.push_back({ layer, depth, texture, quadVertices_.size() });
+    quadVertices_.emplace_back(corners[0], color, sf::Vector2f(left, top));
+    quadVertices_.emplace_back(corners[1], color, sf::Vector2f(right, top));
+    quadVertices_.emplace_back(corners[2], color, sf::Vector2f(right, bottom));
+    quadVertices_.emplace_back(corners[3], color, sf::Vector2f(left, bottom));
+}
+
+/**
+ * @brief Function that returns whether the outlines are drawn
+ */
+bool SpriteBatch::isDebugDrawing() const
+{
+    return debugDrawing_;
+}
+
+/**
+ * @brief Function that returns the number of quads added since the last flush
+ */
+std::size_t SpriteBatch::getQuadCount() const
+{
+    return quads_.size();
+}
+
+/**
+ * @brief Function that returns the number of draws recorded by the last flush
+ */
+std::size_t SpriteBatch::getDrawCount() const
+{
+    return drawCount_;
+}
+
+/**
+ * @brief Function that changes whether the outlines are drawn
+ * @param debugDrawing  Outlines drawn or not
+ */
+void SpriteBatch::setDebugDrawing(bool debugDrawing)
+{
+    debugDrawing_ = debugDrawing;
+}
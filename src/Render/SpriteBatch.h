@@ -0,0 +1,65 @@
+#ifndef SPRITE_BATCH_H
+#define SPRITE_BATCH_H
+
+#include "SFML/Graphics.hpp"
+
+class RenderSnapshot;
+
+// Textured quads collected during a frame and recorded with one draw per texture
+// Quads are sorted by layer, then by depth (bottom of the quad : lower on the screen is drawn later),
+// then in the order they were added. Consecutive quads with the same texture share a draw
+// Outlines (debug hitboxes) are drawn as lines, on top of the quads, only while debug drawing is on
+class SpriteBatch
+{
+public:
+
+    enum Layer
+    {
+        ENTITIES, EFFECTS
+    };
+
+    SpriteBatch();
+    virtual ~SpriteBatch();
+
+    void clear();
+    void flush(RenderSnapshot& target);
+
+    void draw(const sf::Sprite& sprite, Layer layer = ENTITIES);
+    void draw(const sf::Sprite& sprite, Layer layer, float depth);
+    void draw(const sf::Texture* texture, const sf::IntRect& textureRect, const sf::Vector2f& position,
+            const sf::Color& color = sf::Color::White, Layer layer = ENTITIES);
+    void drawOutline(const sf::FloatRect& rect, const sf::Color& color);
+
+    // Getters
+    bool isDebugDrawing() const;
+    std::size_t getQuadCount() const;
+    std::size_t getDrawCount() const;
+
+    // Setters
+    void setDebugDrawing(bool debugDrawing);
+
+private:
+
+    // Quad added (its vertices are the 4 vertices from first in quadVertices_)
+    struct Quad
+    {
+        Layer layer;
+        float depth;
+        const sf::Texture* texture;
+        std::size_t first;
+    };
+
+    void addQuad(const sf::Texture* texture, const sf::Vector2f* corners, const sf::IntRect& textureRect,
+            const sf::Color& color, Layer layer, float depth);
+
+    // Every list keeps its memory from one frame to the next
+    std::vector<Quad> quads_;
+    std::vector<sf::Vertex> quadVertices_;      // In the order the quads were added
+    std::vector<sf::Vertex> vertices_;          // Sorted, recorded by flush
+    std::vector<sf::Vertex> lines_;
+
+    bool debugDrawing_;
+    std::size_t drawCount_;                     // Draws recorded by the last flush
+};
+
+#endif
@@ -0,0 +1,120 @@
+#include "../headers.h"
+#include "TextureAtlas.h"
+
+/**
+ * @brief Constructor
+ */
+TextureAtlas::TextureAtlas()
+    :   texture_(std::make_shared<sf::Texture>())
+    ,   size_(0, 0)
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+TextureAtlas::~TextureAtlas()
+{
+
+}
+
+/**
+ * @brief Function that adds an image to pack
+ * @param name          Name of the image (to find its rectangle)
+ * @param image         Image (copied until pack)
+ */
+void TextureAtlas::add(const std::string& name, const sf::Image& image)
+{
+    images_.emplace_back(name, image);
+}
+
+/**
+ * @brief Function that places every image added and creates the texture
+ * @param maxWidth      Maximum width of the atlas (a wider image gets a row of its own)
+ */
+void TextureAtlas::pack(unsigned int maxWidth)
+{
+    // Tallest first : the shelves waste less space
+    std::sort(images_.begin(), images_.end(), [](const auto& a, const auto& b) {
+        return a.second.getSize().y > b.second.getSize().y;
+    });
+
+    // Places on shelves
+    unsigned int x = 0, y = 0, shelfHeight = 0;
+    size_ = sf::Vector2u(0, 0);
+    for (const auto& image : images_)
+    {
+        sf::Vector2u imageSize = image.second.getSize();
+        if (x > 0 && x + imageSize.x > maxWidth)
+        {
+            x = 0;
+            y += shelfHeight + PADDING;
+            shelfHeight = 0;
+        }
+
+        rects_[image.first] = sf::IntRect(static_cast<int>(x), static_cast<int>(y), static_cast<int>(imageSize.x), static_cast<int>(imageSize.y));
+        x += imageSize.x + PADDING;
+        shelfHeight = std::max(shelfHeight, imageSize.y);
+        size_.x = std::max(size_.x, x - PADDING);
+        size_.y = std::max(size_.y, y + shelfHeight);
+    }
+
+    if (size_.x > sf::Texture::getMaximumSize() || size_.y > sf::Texture::getMaximumSize())
+        throw("Error : Texture atlas bigger than the maximum size of a texture");
+
+    // Copies the images
+    sf::Image atlas;
+    atlas.create(size_.x, size_.y, sf::Color::Transparent);
+    for (const auto& image : images_)
+    {
+        const sf::IntRect& rect = rects_[image.first];
+        atlas.copy(image.second, static_cast<unsigned int>(rect.left), static_cast<unsigned int>(rect.top));
+    }
+
+    if (!texture_->loadFromImage(atlas))
+        throw("Error : Could not create the texture atlas");
+
+    images_.clear();
+}
+
+/**
+ * @brief Function that returns whether an image was packed
+ * @param name          Name of the image
+ */
+bool TextureAtlas::contains(const std::string& name) const
+{
+    return rects_.find(name) != rects_.end();
+}
+
+/**
+ * @brief Function that returns the rectangle of an image in the atlas
+ * @param name          Name of the image
+ */
+const sf::IntRect& TextureAtlas::getRect(const std::string& name) const
+{
+    const auto& rect = rects_.find(name);
+    if (rect == rects_.end())
+    {
+        std::cout << "Atlas image : " << name << "\n";
+        throw("Error : Image not found in the texture atlas");
+    }
+
+    return rect->second;
+}
+
+/**
+ * @brief Function that returns the texture of the atlas (empty until pack)
+ */
+std::shared_ptr<sf::Texture> TextureAtlas::getTexture() const
+{
+    return texture_;
+}
+
+/**
+ * @brief Function that returns the size of the atlas (in pixels)
+ */
+sf::Vector2u TextureAtlas::getSize() const
+{
+    return size_;
+}
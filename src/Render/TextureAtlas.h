@@ -0,0 +1,43 @@
+#ifndef TEXTURE_ATLAS_H
+#define TEXTURE_ATLAS_H
+
+#include "SFML/Graphics.hpp"
+
+// Part of a texture (a sprite sheet in an atlas)
+struct TextureRegion
+{
+    std::shared_ptr<sf::Texture> texture;
+    sf::IntRect rect;
+};
+
+// Several images packed into one texture : everything drawn from the atlas can share a draw
+// Images are placed on shelves (rows), from the tallest to the shortest, with a transparent border
+class TextureAtlas
+{
+public:
+
+    static constexpr unsigned int PADDING = 1;      // Border between two images (no bleeding when rotated)
+
+    TextureAtlas();
+    virtual ~TextureAtlas();
+
+    void add(const std::string& name, const sf::Image& image);
+    void pack(unsigned int maxWidth);
+
+    // Getters
+    bool contains(const std::string& name) const;
+    const sf::IntRect& getRect(const std::string& name) const;
+    std::shared_ptr<sf::Texture> getTexture() const;
+    sf::Vector2u getSize() const;
+
+private:
+
+    // Images waiting to be packed
+    std::vector<std::pair<std::string, sf::Image>> images_;
+
+    std::unordered_map<std::string, sf::IntRect> rects_;
+    std::shared_ptr<sf::Texture> texture_;
+    sf::Vector2u size_;
+};
+
+#endif
@@ -0,0 +1,130 @@
+#include "../headers.h"
+#include "InputScript.h"
+#include "../Math/Random.h"
+
+/**
+ * @brief Constructor (empty script : the player does not move)
+ */
+InputScript::InputScript()
+{
+
+}
+
+/**
+ * @brief Destructor
+ */
+InputScript::~InputScript()
+{
+
+}
+
+/**
+ * @brief Function that adds a move at the end of the script
+ * @param direction     Direction of the move (NOT_MOVING to wait)
+ * @param steps         Duration of the move in simulation steps
+ */
+void InputScript::add(Direction direction, int steps)
+{
+    if (steps <= 0)
+        return;
+
+    moves_.push_back({ direction, getLength() + static_cast<std::size_t>(steps) });
+}
+
+/**
+ * @brief Function that adds the moves of a file (one move per line : LEFT, RIGHT, UP, DOWN or WAIT and a number of steps)
+ * @param path          Path of the script
+ */
+void InputScript::load(const std::string& path)
+{
+    std::ifstream file(path);
+    if (!file)
+    {
+        std::cout << "Script : " << path << "\n";
+        throw("Error : Could not read the input script");
+    }
+
+    const std::map<std::string, Direction> directions = {
+        { "LEFT", LEFT }, { "RIGHT", RIGHT }, { "UP", UP }, { "DOWN", DOWN }, { "WAIT", NOT_MOVING }
+    };
+
+    std::string direction = "";
+    int steps = 0;
+    while (file >> direction >> steps)
+    {
+        add(directions.at(direction), steps);
+    }
+}
+
+/**
+ * @brief Function that moves the player like the keyboard would (@see GameState::handleKeyboardInputs)
+ * @param player        Player
+ * @param step          Simulation step
+ */
+void InputScript::apply(Player& player, std::size_t step) const
+{
+    Direction direction = getDirection(step);
+    if (direction == NOT_MOVING || !player.isDirectionAvailable(direction))
+        return;
+
+    switch (direction)
+    {
+        case LEFT:
+            player.move(-1.0f, 0.0f);
+            break;
+        case RIGHT:
+            player.move(1.0f, 0.0f);
+            break;
+        case UP:
+            player.move(0.0f, -1.0f);
+            break;
+        case DOWN:
+            player.move(0.0f, 1.0f);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * @brief Function that returns the direction of the move at a step (the script loops)
+ * @param step          Simulation step
+ */
+Direction InputScript::getDirection(std::size_t step) const
+{
+    if (moves_.empty())
+        return NOT_MOVING;
+
+    step %= getLength();
+    auto move = std::upper_bound(moves_.begin(), moves_.end(), step,
+            [] (std::size_t value, const Move& move) { return value < move.end; });
+
+    return move->direction;
+}
+
+/**
+ * @brief Function that returns the number of steps of the script (before looping)
+ */
+std::size_t InputScript::getLength() const
+{
+    return moves_.empty() ? 0 : moves_.back().end;
+}
+
+/**
+ * @brief Function that creates a script of random moves (the same seed gives the same script)
+ * @param seed          Seed of the moves
+ * @param moves         Number of moves
+ * @param stepsPerMove  Duration of each move in simulation steps
+ */
+InputScript InputScript::createRandomWalk(std::uint64_t seed, int moves, int stepsPerMove)
+{
+    RandomStream random(seed, Random::INPUT_SCRIPT);
+
+    InputScript script;
+    for (int i = 0; i < moves; ++i)
+    {
+        script.add(static_cast<Direction>(random.nextInt(0, NOT_MOVING)), stepsPerMove);
+    }
+
+    return script;
+}
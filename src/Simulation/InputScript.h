@@ -0,0 +1,35 @@
+#ifndef INPUT_SCRIPT_H
+#define INPUT_SCRIPT_H
+
+#include "../Entities/Player.h"
+
+// Movements of the player played step by step instead of the keyboard (headless simulation)
+// Each move lasts a number of simulation steps, the script loops once finished
+class InputScript
+{
+public:
+
+    InputScript();
+    virtual ~InputScript();
+
+    void add(Direction direction, int steps);
+    void load(const std::string& path);
+    void apply(Player& player, std::size_t step) const;
+
+    Direction getDirection(std::size_t step) const;
+    std::size_t getLength() const;
+
+    static InputScript createRandomWalk(std::uint64_t seed, int moves, int stepsPerMove);
+
+private:
+
+    struct Move
+    {
+        Direction direction;
+        std::size_t end;        // First step after the move
+    };
+
+    std::vector<Move> moves_;
+};
+
+#endif
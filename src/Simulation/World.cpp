@@ -0,0 +1,201 @@
+#include "../headers.h"
+#include "World.h"
+#include "../Profiling/Profiler.h"
+
+/**
+ * @brief Constructor
+ * @param viewSize      Size of the view (size of the window)
+ * @param seed          Seed of the terrain and of the spawns
+ * @param mode          Where the world is drawn (nowhere when headless)
+ */
+World::World(const sf::Vector2f& viewSize, int seed, Mode mode)
+    :   mode_(mode)
+    ,   alpha_(1.0f)
+
+    ,   player_(
+            std::make_shared<Player>(Vector(0, 0),      // Position
+            Vector(PLAYER_SIZE),                        // Size
+            MovementComponents(400.0f, 1740.0f, 300.0f))    // Max velocity, acceleration, deceleration (per second)
+        )
+
+    ,   view_(
+            (player_->getPosition() - player_->getSize() * 0.5f).getAsVector2f(),   // Center at the player's position
+            viewSize
+        )
+
+    ,   map_(view_, *player_, player_->getPosition(), seed, mode != HEADLESS, mode == GAME)      // Center of the map
+    ,   demonSpawner_(
+            player_->getCenter(), 32 * TileHandler::DEFAULT_SIZE, EntityArchetype {
+                Vector(PLAYER_SIZE),                                // Size
+                Vector(0.0f, 0.0f), Vector(32.0f, 32.0f),           // Hitbox offset and size
+                MovementComponents(300.0f, 1740.0f, 300.0f),
+                50.0f, 0.2f,                                        // Life, experience
+                AnimationTable::getID("demon_walk"),                // Clip
+                TextureRegion {}                                    // Sprite sheet (see addTextures)
+            }, MAX_DEMONS, static_cast<std::uint64_t>(seed)
+        )
+{
+    player_->setPosition(Vector(0, 32));
+
+    view_.zoom(0.5f);
+    view_.setCenter(player_->getCenter().getAsVector2f());
+
+    // Animations without textures
+    if (mode_ == HEADLESS)
+        addTextures(TextureRegion {}, TextureRegion {}, TextureRegion {}, TextureRegion {});
+}
+
+/**
+ * @brief Destructor
+ */
+World::~World()
+{
+
+}
+
+/**
+ * @brief Function that updates the world by one simulation step
+ * @param dt            Duration of the step
+ */
+void World::update(const float& dt)
+{
+    player_->update(dt);
+    view_.move(player_->getVelocity().getX() * dt, player_->getVelocity().getY() * dt);
+
+    if (!(player_->getVelocity() == Vector(0.0f)))
+        map_.update(dt);
+
+    // Chunks generated by the workers are added even while the player stands still
+    map_.updateChunks();
+
+    // Same chunks whatever the speed of the workers
+    if (mode_ != GAME)
+        map_.waitForLoading();
+
+    demonSpawner_.update(dt);
+    demonSpawner_.separate();
+    collideTerrain();
+    demonSpawner_.collide(*player_);
+}
+
+/**
+ * @brief Function that collides the player and the demons with the terrain in a single pass
+ */
+void World::collideTerrain()
+{
+    ProfileZone zone("World::collideTerrain");
+
+    terrainBodies_.clear();
+    terrainBodies_.push_back(player_->getTerrainBody());
+    demonSpawner_.addTerrainBodies(terrainBodies_);
+
+    map_.collide(terrainBodies_.data(), terrainBodies_.size());
+
+    player_->applyTerrainCollision(terrainBodies_[0]);
+    demonSpawner_.applyTerrainCollision(terrainBodies_.data() + 1);
+}
+
+/**
+ * @brief Function that renders the map and the entities
+ * @param target        Where to draw the world
+ */
+void World::render(std::shared_ptr<RenderSnapshot> target)
+{
+    target->setView(getInterpolatedView());
+    map_.render(target);
+    renderEntities(target);
+}
+
+/**
+ * @brief Function that renders the player and the demons (batched : one draw per texture)
+ * @param target        Where to draw the entities
+ */
+void World::renderEntities(std::shared_ptr<RenderSnapshot> target)
+{
+    target->beginSection("entities");
+    player_->render(target);
+    demonSpawner_.render(target);
+    target->flushBatch();
+}
+
+/**
+ * @brief Function that renders the tiles drawn over the entities
+ * @param target        Where to draw the tiles
+ */
+void World::renderOnTop(std::shared_ptr<RenderSnapshot> target)
+{
+    map_.renderOnTop(target);
+}
+
+/**
+ * @brief Function that places the entities and the camera between the last two simulation steps
+ * @param alpha         Time since the last step (fraction of a step)
+ */
+void World::interpolate(const float& alpha)
+{
+    alpha_ = alpha;
+    player_->interpolate(alpha);
+    demonSpawner_.interpolate(alpha);
+}
+
+/**
+ * @brief Function that returns the camera between the last two simulation steps (@see interpolate)
+ */
+sf::View World::getInterpolatedView() const
+{
+    sf::View view = view_;
+    view.move((player_->getInterpolatedPosition(alpha_) - player_->getPosition()).getAsVector2f());
+
+    return view;
+}
+
+/**
+ * @brief Function that centers the camera on the player
+ */
+void World::centerView()
+{
+    view_.setCenter(player_->getPosition().getAsVector2f());
+}
+
+/**
+ * @brief Function that adds the sprite sheets of the entities
+ * @param player        Sprite sheet of the player
+ * @param sword         Sprite sheet of the sword
+ * @param attack        Sprite sheet of the swoosh of the sword
+ * @param demon         Sprite sheet of the demons
+ */
+void World::addTextures(const TextureRegion& player, const TextureRegion& sword, const TextureRegion& attack, const TextureRegion& demon)
+{
+    player_->addTexture(player);
+    player_->addSwordTexture(sword, attack);
+    demonSpawner_.addTexture(demon);
+}
+
+/**
+ * @brief Function that returns a hash of the positions of the entities and of the chunks loaded
+ * Two headless simulations with the same seed and inputs must give the same hash (@see Mode)
+ */
+std::uint64_t World::getStateHash() const
+{
+    std::uint64_t hash = 0;
+    auto combine = [&hash] (float value)
+    {
+        std::uint32_t bits;
+        std::memcpy(&bits, &value, sizeof(bits));
+        hash = Random::mix(hash ^ bits);
+    };
+
+    combine(player_->getPosition().getX());
+    combine(player_->getPosition().getY());
+
+    const EntityRegistry& demons = demonSpawner_.getEntities();
+    for (EntityRegistry::Index i = 0; i < demons.size(); ++i)
+    {
+        combine(demons.getPosition(i).getX());
+        combine(demons.getPosition(i).getY());
+    }
+
+    combine(static_cast<float>(map_.getNumberOfChunks()));
+
+    return hash;
+}
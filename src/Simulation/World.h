@@ -0,0 +1,78 @@
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "../Drawable.h"
+#include "../Entities/Player.h"
+#include "../Entities/DemonSpawner.h"
+#include "../Map/Map.h"
+
+// Everything simulated in a game : the player, the map around it and the demons
+// Used by the game state, by the headless simulation and by the render benchmark
+class World
+    :   public Drawable
+{
+public:
+
+    static constexpr float PLAYER_SIZE = 64.f;
+    static constexpr int MAX_DEMONS = 5;
+
+    // HEADLESS and OFFSCREEN worlds save nothing and generate the chunks needed before each step :
+    // the same seed and inputs always give the same world
+    enum Mode
+    {
+        GAME,           // Window
+        HEADLESS,       // No window : no texture
+        OFFSCREEN       // Drawn into a texture (benchmarks)
+    };
+
+    World(const sf::Vector2f& viewSize, int seed = Map::loadSeed(), Mode mode = GAME);
+    virtual ~World();
+
+    virtual void update(const float& dt);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
+    virtual void renderEntities(std::shared_ptr<RenderSnapshot> target);
+    virtual void renderOnTop(std::shared_ptr<RenderSnapshot> target);
+    virtual void interpolate(const float& alpha);
+
+    void centerView();
+    void addTextures(const TextureRegion& player, const TextureRegion& sword, const TextureRegion& attack, const TextureRegion& demon);
+    std::uint64_t getStateHash() const;
+    sf::View getInterpolatedView() const;
+
+    // Getters
+    Player& getPlayer()
+        { return *player_; };
+
+    const Player& getPlayer() const
+        { return *player_; };
+
+    Map& getMap()
+        { return map_; };
+
+    const Map& getMap() const
+        { return map_; };
+
+    const DemonSpawner& getDemonSpawner() const
+        { return demonSpawner_; };
+
+    const sf::View& getView() const
+        { return view_; };
+
+private:
+
+    void collideTerrain();
+
+    const Mode mode_;
+    float alpha_;
+
+    std::shared_ptr<Player> player_;
+    sf::View view_;             // Camera following the player (declared before the map : used by the map)
+    Map map_;
+    DemonSpawner demonSpawner_;
+
+    // Every movable entity colliding with the terrain (kept between frames to reuse its memory)
+    std::vector<TerrainBody> terrainBodies_;
+
+};
+
+#endif
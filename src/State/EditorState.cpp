@@ -56,11 +56,8 @@ void EditorState::update(const float& dt)
  *  @brief Function that renders the game state
  *  @param target   RenderWindow where the state will be drawn
  */
-void EditorState::render(std::shared_ptr<sf::RenderTarget> target)
+void EditorState::render(std::shared_ptr<RenderSnapshot> target)
 {
-    if (!target)
-        target = window_;
-
     renderButtons(target);
 }
 
@@ -69,7 +66,6 @@ void EditorState::render(std::shared_ptr<sf::RenderTarget> target)
  */
 void EditorState::loadTextures()
 {
-    sf::Texture texture;
 
 }
 
@@ -145,7 +141,7 @@ void EditorState::updateButtons(const float& dt)
 /**
  * @brief Function that renders the buttons of the state
  */
-void EditorState::renderButtons(std::shared_ptr<sf::RenderTarget> target)
+void EditorState::renderButtons(std::shared_ptr<RenderSnapshot> target)
 {
 
     for (auto& button : buttons_)
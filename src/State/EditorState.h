@@ -16,7 +16,7 @@ public:
     // Functions
     virtual void handleKeyboardInputs();
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
     virtual void loadTextures();
 
 private:
@@ -34,7 +34,7 @@ private:
     virtual void initFonts();
 
     void updateButtons(const float& dt);
-    void renderButtons(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    void renderButtons(std::shared_ptr<RenderSnapshot> target = nullptr);
     void handleButtonEvents();
 
 };
@@ -1,6 +1,10 @@
 #include "../headers.h"
 #include "GameState.h"
 
+const std::string GameState::FONT = "fonts/basic_font.ttf";
+const std::string GameState::DEFAULT_BUTTON = "resources/menu/default_button.png";
+const std::string GameState::PROFILE_FILE = "profile.json";
+
 /**
  * @brief Constructor with parameters
  * @param states    Stack of the states in the game
@@ -9,54 +13,28 @@
  */
 GameState::GameState(std::stack<std::unique_ptr<State>>& states, std::shared_ptr<sf::RenderWindow> window, std::map<std::string, int>* keys)
     :   State(states, window, keys)
-    
-    ,   player_(
-            std::make_shared<Player>(Vector(0, 0),      // Position
-            Vector(PLAYER_SIZE),                        // Size
-            MovementComponents(400.0f, 29.0f, 5.0f))    // Max velocity, acceleration, deceleration
-        )   
-    
-    ,   view_(
-            (player_->getPosition() - player_->getSize() * 0.5f).getAsVector2f(),   // Center at the player's position
-            sf::Vector2f(window_->getSize().x, window_->getSize().y)                // Size of the window
-        )  
-    
-    ,   map_(view_, *player_, player_->getPosition())   // Center of the map
+    ,   world_(sf::Vector2f(static_cast<float>(window_->getSize().x), static_cast<float>(window_->getSize().y)))         // View of the size of the window
     ,   pauseMenu_(window)
     ,   inventoryBar_(
             Vector(static_cast<float>(window_->getSize().x) / 2.0f - 16 * TileHandler::DEFAULT_SIZE / 2.0f, static_cast<float>(window_->getSize().y) - 4 * TileHandler::DEFAULT_SIZE).getAsVector2f(),
             Vector(16 * TileHandler::DEFAULT_SIZE, 2 * TileHandler::DEFAULT_SIZE)
         )
-    ,   demonSpawner_(
-            player_->getCenter(), 32 * TileHandler::DEFAULT_SIZE, Demon(
-                Vector(0.0f, 0.0f),
-                Vector(PLAYER_SIZE),
-                player_->getCenter(),
-                MovementComponents(300.0f, 29.0f, 5.0f)
-            ), 5
-        )
-    ,   renderTexture_(std::make_shared<sf::RenderTexture>())
-    ,   lastView_(window_->getView())
+    ,   lastView_(window_->getDefaultView())
+    ,   showHitboxes_(false)
+    ,   showProfiler_(false)
 {
 
     std::cout << "Game State created\n";
 
-    if (!font_.loadFromFile("fonts/basic_font.ttf"))
-        throw("Font in Game state couldn't be loaded");
+    font_ = ResourceCache::getFont(FONT);
 
     initExperienceBar();
+    initProfilerOverlay();
 
-    player_->setPosition(Vector(0, 32));
-
-    initView();
     loadTextures();
     initPauseMenu();
     initEntities();
     initKeybinds();
-
-    if (!renderTexture_->create(window_->getSize().x, window_->getSize().y))
-        throw("Render texture coudln't be loaded");
-
 }
 
 /**
@@ -64,7 +42,6 @@ GameState::GameState(std::stack<std::unique_ptr<State>>& states, std::shared_ptr
  */
 GameState::~GameState()
 {
-    window_->setView(lastView_);
     std::cout << "Game State deleted" << std::endl;
 }
 
@@ -77,22 +54,33 @@ void GameState::handleKeyboardInputs()
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("PAUSE"))) && getKeyTime())
         pause();
 
+    // Debug
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("TOGGLE_HITBOXES"))) && getKeyTime())
+        showHitboxes_ = !showHitboxes_;
+
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("TOGGLE_PROFILER"))) && getKeyTime())
+        showProfiler_ = !showProfiler_;
+
+    if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("EXPORT_PROFILE"))) && getKeyTime())
+        Profiler::exportChromeTrace(PROFILE_FILE);
+
     // Player movement
-    if (player_->isDirectionAvailable(LEFT) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_LEFT"))))
+    Player& player = world_.getPlayer();
+    if (player.isDirectionAvailable(LEFT) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_LEFT"))))
     {
-        player_->move(-1.0f, 0.0f);
+        player.move(-1.0f, 0.0f);
     }
-    if (player_->isDirectionAvailable(RIGHT) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_RIGHT"))))
+    if (player.isDirectionAvailable(RIGHT) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_RIGHT"))))
     {
-        player_->move(1.0f, 0.0f);
+        player.move(1.0f, 0.0f);
     }
-    if (player_->isDirectionAvailable(DOWN) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_DOWN"))))
+    if (player.isDirectionAvailable(DOWN) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_DOWN"))))
     {
-        player_->move(0.0f, 1.0f);
+        player.move(0.0f, 1.0f);
     }
-    if (player_->isDirectionAvailable(UP) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_UP"))))
+    if (player.isDirectionAvailable(UP) && sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("MOVE_UP"))))
     {
-        player_->move(0.0f, -1.0f);
+        player.move(0.0f, -1.0f);
     }
 }
 
@@ -104,8 +92,7 @@ void GameState::handlePausedKeyboardInputs()
     if (sf::Keyboard::isKeyPressed(sf::Keyboard::Key(keybinds_.at("PAUSE"))) && getKeyTime())
     {
         unpause();  
-        view_.setCenter(player_->getPosition().getAsVector2f());
-        window_->setView(view_);
+        world_.centerView();
     }
 }
 
@@ -126,7 +113,7 @@ void GameState::handleButtonEvents()
 void GameState::updateMousePosition()
 {
     State::updateMousePosition();
-    mousePositionMap_ = Vector(player_->getPosition() - Vector(window_->getView().getSize() * 0.5f));
+    mousePositionMap_ = Vector(world_.getPlayer().getPosition() - Vector(lastView_.getSize() * 0.5f));
     mousePositionMap_ += mousePositionScreen + Vector(32, 0);
 }
 
@@ -136,26 +123,26 @@ void GameState::updateMousePosition()
  */
 void GameState::update(const float& dt)
 {
+    ProfileZone zone("GameState::update");
+
     updateMousePosition();
     updateKeyTime(dt);
 
     DamageRenderer::update(dt);
 
+    if (showProfiler_)
+        profilerOverlay_->update(dt);
+
     if (!paused_)
     {
-        player_->update(dt);
-        view_.move(player_->getVelocity().getX() * dt, player_->getVelocity().getY() * dt);
-        player_->handleMouseEvents(mousePositionMap_);
-
-        if (!(player_->getVelocity() == Vector(0.0f)))
-            map_.update(dt);
+        // The sword aims from the simulated position, not from the last frame drawn
+        world_.getPlayer().restorePosition();
+        world_.getPlayer().handleMouseEvents(mousePositionMap_);
+        world_.update(dt);
 
         inventoryBar_.update(dt);
         experienceBar_->update(dt);
 
-        demonSpawner_.update(dt);
-        demonSpawner_.collide(*player_);
-
         handleKeyboardInputs();
 
     }
@@ -173,83 +160,62 @@ void GameState::update(const float& dt)
  *  @brief Function that renders the game state
  *  @param target   RenderWindow where the state will be drawn
  */
-void GameState::render(std::shared_ptr<sf::RenderTarget> target)
+void GameState::render(std::shared_ptr<RenderSnapshot> target)
 {
-    if (!target)
-        target = renderTexture_;
-
-    window_->setView(view_);
-    map_.render(target);
-
-    // Rendering entities
-
-    player_->render(target);
+    // Entities and camera drawn between the last two simulation steps (no simulation while paused)
+    world_.interpolate(paused_ ? 1.0f : interpolation_);
 
-    demonSpawner_.render(target);
-
-    // End of entities render
-
-    map_.renderOnTop(target);
+    target->getBatch().setDebugDrawing(showHitboxes_);
+    world_.render(target);
+    world_.renderOnTop(target);
 
+    target->beginSection("damage");
     DamageRenderer::render(target);
 
-    window_->setView(lastView_);
+    target->beginSection("HUD");
+    target->setView(lastView_);
     inventoryBar_.render(target);
     experienceBar_->render(target);
 
     if (paused_)
     {
+        target->beginSection("pause menu");
         pauseMenu_.render(target);
     }
-    
-    renderSprite_.setTexture(renderTexture_->getTexture());
-    window_->draw(renderSprite_);
+
+    if (showProfiler_)
+    {
+        target->beginSection("profiler");
+        profilerOverlay_->render(target);
+    }
 }
 
 /**
- * @brief Function that loads the textures needed by the state
+ * @brief Function that loads the textures needed by the state (the map loads its own)
  */
 void GameState::loadTextures()
 {
-    map_.loadTextures();
     loadPlayerTextures();
     loadEntitiesTexture();
     loadPauseMenuTextures();
 }
 
 /**
- * @brief Function that loads the textures needed by the player
+ * @brief Function that loads the sprite sheets needed by the player
  */
 void GameState::loadPlayerTextures() 
 {
-    sf::Texture texture;
-
-    // Player texture
-    if (!texture.loadFromFile("resources/game/player/player_sprite_sheet.png"))
-        throw("Error : Could not load player's sprite sheet texture");
-
-    textures_["PLAYER_SPRITE_SHEET"] = std::make_shared<sf::Texture>(texture);
-
-    if (!texture.loadFromFile("resources/game/player/sword_sprite_sheet.png"))
-        throw("Error : Could not load player's sprite sheet texture");
-
-    textures_["SWORD_SPRITE_SHEET"] = std::make_shared<sf::Texture>(texture);
-
+    sheets_["PLAYER_SPRITE_SHEET"] = ResourceCache::getSheet("PLAYER_SPRITE_SHEET");
+    sheets_["SWORD_SPRITE_SHEET"] = ResourceCache::getSheet("SWORD_SPRITE_SHEET");
+    sheets_["ATTACK_SPRITE_SHEET"] = ResourceCache::getSheet("ATTACK_SPRITE_SHEET");
 }
 
 /**
- * @brief Function that loads the textures needed by the player
+ * @brief Function that loads the sprite sheets needed by the entities
  */
 void GameState::loadEntitiesTexture() 
 {
-    sf::Texture texture;
-
-    // Player texture
-    if (!texture.loadFromFile("resources/game/enemy_sprite_sheet.png"))
-        throw("Error : Could not load player's sprite sheet texture");
-
-    textures_["DEMON"] = std::make_shared<sf::Texture>(texture);
-
+    sheets_["DEMON"] = ResourceCache::getSheet("DEMON_SPRITE_SHEET");
 }
 
 /**
@@ -257,12 +223,35 @@ void GameState::loadEntitiesTexture()
  */
 void GameState::loadPauseMenuTextures()
 {
-    sf::Texture texture;
+    textures_["DEFAULT_BUTTON"] = ResourceCache::getTexture(DEFAULT_BUTTON);
+}
+
+/**
+ * @brief Function that adds every resource needed by the state to a loader (the state then finds them in the cache)
+ * @param loader        Loader of the loading screen
+ */
+void GameState::addAssets(AssetLoader& loader)
+{
+    loader.addAtlas();
+    loader.addTexture(Map::SPRITE_SHEET);
+    loader.addTexture(DEFAULT_BUTTON);
+    loader.addFont(FONT);
+}
 
-    if (!texture.loadFromFile("resources/menu/default_button.png"))
-        throw("Error : Could not load quit button texture");
+/**
+ * @brief Function called by the loading screen : adds the chunks generated around the spawn
+ */
+void GameState::updateLoading()
+{
+    world_.getMap().updateChunks();
+}
 
-    textures_["DEFAULT_BUTTON"] = std::make_shared<sf::Texture>(texture);
+/**
+ * @brief Function that returns the fraction of the chunks around the spawn that are generated (between 0 and 1)
+ */
+float GameState::getLoadingProgress() const
+{
+    return world_.getMap().getLoadingProgress();
 }
 
 /**
@@ -270,10 +259,7 @@ void GameState::loadPauseMenuTextures()
  */
 void GameState::initEntities()
 {
-    player_->addTexture(textures_["PLAYER_SPRITE_SHEET"]);
-    player_->addSwordTexture(textures_["SWORD_SPRITE_SHEET"]);
-
-    demonSpawner_.addTexture(textures_["DEMON"]);
+    world_.addTextures(sheets_["PLAYER_SPRITE_SHEET"], sheets_["SWORD_SPRITE_SHEET"], sheets_["ATTACK_SPRITE_SHEET"], sheets_["DEMON"]);
 }
 
 /**
@@ -329,27 +315,25 @@ void GameState::initPauseMenu()
     pauseMenu_.addTextureToButton("QUIT", textures_.at("DEFAULT_BUTTON"));
 }
 
-/**
- * @brief Function that initializes the view
- */
-void GameState::initView()
-{
-    view_.zoom(0.5f);
-    view_.setCenter(player_->getCenter().getAsVector2f());
-    renderTexture_->setView(view_);
-}
-
 /**
  * @brief Function that initializes the experience bar
  */
 void GameState::initExperienceBar()
 {
-    experienceBar_ = std::make_unique<HUD::ExperienceBar>(font_, Vector(512.0f, 8.0f), Vector(
+    experienceBar_ = std::make_unique<HUD::ExperienceBar>(*font_, Vector(512.0f, 8.0f), Vector(
         window_->getSize().x / 2.0f - 512.0f / 2.0f,
         16.0f
     ));
 
-    player_->addExperienceBar(experienceBar_.get());
+    world_.getPlayer().addExperienceBar(experienceBar_.get());
+}
+
+/**
+ * @brief Function that initializes the debug panel of the profiler (under the experience bar)
+ */
+void GameState::initProfilerOverlay()
+{
+    profilerOverlay_ = std::make_unique<HUD::ProfilerOverlay>(*font_, Vector(8.0f, 40.0f));
 }
 
 
@@ -2,21 +2,22 @@
 #define GAMESTATE_H
 
 #include "State.h"
-#include "../Entities/Player.h"
-#include "../Entities/Demon.h"
-#include "../Entities/DemonSpawner.h"
+#include "../Simulation/World.h"
 #include "../Menu/PauseMenu.h"
-#include "../Map/Map.h"
 #include "../HUD/InventoryBar.h"
 #include "../Entities/DamageRenderer.h"
 #include "../HUD/ExperienceBar.h"
+#include "../HUD/ProfilerOverlay.h"
+#include "../Render/AssetLoader.h"
 
 class GameState
     : public State
 {
 public:
 
-    static constexpr float PLAYER_SIZE = 64.f;
+    static const std::string FONT;
+    static const std::string DEFAULT_BUTTON;
+    static const std::string PROFILE_FILE;
 
     GameState(std::stack<std::unique_ptr<State>>& states, std::shared_ptr<sf::RenderWindow> window, std::map<std::string, int>* keys);
     virtual ~GameState();
@@ -28,10 +29,15 @@ public:
     virtual void updateMousePosition();
 
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
 
     virtual void loadTextures();
 
+    // Loading (see LoadingState)
+    static void addAssets(AssetLoader& loader);
+    void updateLoading();
+    float getLoadingProgress() const;
+
 private:
 
     virtual void loadPlayerTextures();
@@ -41,20 +47,19 @@ private:
     virtual void initEntities();
     virtual void initKeybinds();
     virtual void initPauseMenu();
-    virtual void initView();
     virtual void initExperienceBar();
+    virtual void initProfilerOverlay();
 
-    std::shared_ptr<Player> player_;
-    sf::View view_;
-    Map map_;
+    World world_;               // Player, map and demons
     PauseMenu pauseMenu_;
     HUD::InventoryBar inventoryBar_;
-    DemonSpawner demonSpawner_;
-    std::shared_ptr<sf::RenderTexture> renderTexture_;
-    sf::Sprite renderSprite_;
-    sf::View lastView_;
-    sf::Font font_;
+    sf::View lastView_;         // View of the interface (default view of the window)
+    std::shared_ptr<sf::Font> font_;
     std::unique_ptr<HUD::ExperienceBar> experienceBar_;
+    std::map<std::string, TextureRegion> sheets_;     // Sprite sheets of the entities (in the atlas)
+    std::unique_ptr<HUD::ProfilerOverlay> profilerOverlay_;
+    bool showHitboxes_;         // Debug outlines of the hitboxes
+    bool showProfiler_;         // Debug panel of the profiler
 
     Vector mousePositionMap_;
 
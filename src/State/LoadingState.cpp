@@ -0,0 +1,132 @@
+#include "../headers.h"
+#include "LoadingState.h"
+
+/**
+ * @brief Constructor with parameters (starts loading the resources of the game state)
+ * @param states    Stack of the states in the game
+ * @param window    Window where the state will be drawn into
+ * @param keys      Keys supported by the game
+ */
+LoadingState::LoadingState(std::stack<std::unique_ptr<State>>& states, std::shared_ptr<sf::RenderWindow> window, std::map<std::string, int>* keys)
+    :   State(states, window, keys)
+    ,   font_(ResourceCache::getFont(GameState::FONT))
+{
+    std::cout << "Loading State created" << std::endl;
+
+    GameState::addAssets(loader_);
+    loader_.start();
+
+    initProgressBar();
+}
+
+/**
+ * @brief Destructor
+ */
+LoadingState::~LoadingState()
+{
+    std::cout << "Loading State deleted" << std::endl;
+}
+
+/**
+ * @brief Method that handles keyboard inputs for that specific state
+ */
+void LoadingState::handleKeyboardInputs()
+{
+    //
+}
+
+/**
+ * @brief Function that updates the loading
+ * Resources : a slice of the decoded resources is uploaded each step
+ * Chunks : generated by the chunk workers once the game state is created
+ * @param dt    time since last frame (unused : the loading is not timed)
+ */
+void LoadingState::update(const float& /* dt */)
+{
+    if (!game_)
+    {
+        loader_.upload();
+
+        // Every resource is in the cache : the game state does not read any file
+        if (loader_.isDone())
+            game_ = std::make_unique<GameState>(states_, window_, keys_);
+    }
+    else
+    {
+        game_->updateLoading();
+
+        // Popped with its loader and font : the game state takes its place
+        if (game_->getLoadingProgress() >= 1.0f)
+        {
+            replaceState(std::move(game_));
+            return;
+        }
+    }
+
+    float progress = getProgress();
+    bar_.setSize(sf::Vector2f(BAR_WIDTH * progress, BAR_HEIGHT));
+    text_.setString(std::to_string(static_cast<int>(progress * 100.0f)) + " %");
+}
+
+/**
+ * @brief Function that renders the progress bar
+ * @param target    Where the state will be drawn
+ */
+void LoadingState::render(std::shared_ptr<RenderSnapshot> target)
+{
+    target->draw(background_);
+    target->draw(bar_);
+    target->draw(text_);
+}
+
+/**
+ * @brief Function that loads the textures needed by the state (none : only shapes and text)
+ */
+void LoadingState::loadTextures()
+{
+
+}
+
+/**
+ * @brief Function that returns the progress of the loading (resources then chunks, between 0 and 1)
+ */
+float LoadingState::getProgress() const
+{
+    if (!game_)
+        return 0.5f * loader_.getProgress();
+
+    return 0.5f + 0.5f * game_->getLoadingProgress();
+}
+
+/**
+ * @brief Function that initializes the keybinds of the state (none)
+ */
+void LoadingState::initKeybinds()
+{
+
+}
+
+/**
+ * @brief Function that initializes the progress bar at the center of the window
+ */
+void LoadingState::initProgressBar()
+{
+    sf::Vector2f position(
+        static_cast<float>(window_->getSize().x) / 2.0f - BAR_WIDTH / 2.0f,
+        static_cast<float>(window_->getSize().y) / 2.0f - BAR_HEIGHT / 2.0f
+    );
+
+    background_.setPosition(position);
+    background_.setSize(sf::Vector2f(BAR_WIDTH, BAR_HEIGHT));
+    background_.setFillColor(sf::Color(51, 51, 51));
+
+    bar_.setPosition(position);
+    bar_.setSize(sf::Vector2f(0.0f, BAR_HEIGHT));
+    bar_.setFillColor(sf::Color(255, 255, 255));
+
+    text_.setFont(*font_);
+    text_.setCharacterSize(16);
+    text_.setFillColor(sf::Color(255, 255, 255));
+    text_.setPosition(position.x, position.y + 2.0f * BAR_HEIGHT);
+    text_.setString("0 %");
+}
@@ -0,0 +1,49 @@
+#ifndef LOADING_STATE_H
+#define LOADING_STATE_H
+
+#include "State.h"
+#include "GameState.h"
+#include "../Render/AssetLoader.h"
+
+// Loading screen shown before the game state
+// The resources are decoded in the background and the chunks around the spawn are generated by the chunk workers
+// The game state replaces the loading screen once everything is ready
+class LoadingState
+    :   public State
+{
+public:
+
+    static constexpr float BAR_WIDTH = 512.0f;
+    static constexpr float BAR_HEIGHT = 16.0f;
+
+    // Constructor and Destructor
+    LoadingState(std::stack<std::unique_ptr<State>>& states, std::shared_ptr<sf::RenderWindow> window, std::map<std::string, int>* keys);
+    virtual ~LoadingState();
+
+    // Functions
+    virtual void handleKeyboardInputs();
+    virtual void update(const float& dt);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
+    virtual void loadTextures();
+
+    // Getters
+    float getProgress() const;
+
+private:
+
+    // Functions
+    virtual void initKeybinds();
+    virtual void initProgressBar();
+
+    // Variables
+    AssetLoader loader_;
+    std::unique_ptr<GameState> game_;       // Created once the resources are loaded (null once it replaces the loading state)
+
+    std::shared_ptr<sf::Font> font_;
+    sf::RectangleShape background_;
+    sf::RectangleShape bar_;
+    sf::Text text_;
+
+};
+
+#endif
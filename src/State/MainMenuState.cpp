@@ -50,11 +50,8 @@ void MainMenuState::update(const float& dt)
  *  @brief Function that renders the game state
  *  @param target   RenderWindow where the state will be drawn
  */
-void MainMenuState::render(std::shared_ptr<sf::RenderTarget> target)
+void MainMenuState::render(std::shared_ptr<RenderSnapshot> target)
 {
-    if (!target)
-        target = window_;
-
     renderButtons(target);
 }
 
@@ -63,13 +60,8 @@ void MainMenuState::render(std::shared_ptr<sf::RenderTarget> target)
  */
 void MainMenuState::loadTextures()
 {
-    sf::Texture texture;
-
-    // Play button texture
-    if (!texture.loadFromFile("resources/menu/default_button.png"))
-        throw("Error : Could not load default button texture");
-
-    textures_["DEFAULT_BUTTON"] = std::make_shared<sf::Texture>(texture);
+    // Button texture (shared with the other states)
+    textures_["DEFAULT_BUTTON"] = ResourceCache::getTexture("resources/menu/default_button.png");
 }
 
 /**
@@ -198,7 +190,7 @@ void MainMenuState::updateButtons(const float& dt)
 /**
  * @brief Function that renders the buttons of the state
  */
-void MainMenuState::renderButtons(std::shared_ptr<sf::RenderTarget> target)
+void MainMenuState::renderButtons(std::shared_ptr<RenderSnapshot> target)
 {
 
     for (auto& button : buttons_)
@@ -219,7 +211,7 @@ void MainMenuState::handleButtonEvents()
     } 
     else if (buttons_["PLAY"]->getButtonState() == gui::CLICKED)
     {
-        states_.push(std::make_unique<GameState>(states_, window_, keys_));
+        states_.push(std::make_unique<LoadingState>(states_, window_, keys_));
     }
     else if (buttons_["SETTINGS"]->getButtonState() == gui::CLICKED)
     {
@@ -2,7 +2,7 @@
 #define MAIN_MENU_H
 
 #include "State.h"
-#include "GameState.h"
+#include "LoadingState.h"
 #include "EditorState.h"
 #include "SettingsState.h"
 #include "../GUI/Button.h"
@@ -20,7 +20,7 @@ public:
     // Functions
     virtual void handleKeyboardInputs();
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
     virtual void loadTextures();
 
 private:
@@ -36,7 +36,7 @@ private:
     virtual void initFonts();
 
     void updateButtons(const float& dt);
-    void renderButtons(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    void renderButtons(std::shared_ptr<RenderSnapshot> target = nullptr);
     void handleButtonEvents();
 
 };
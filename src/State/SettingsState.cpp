@@ -55,11 +55,8 @@ void SettingsState::update(const float& dt)
  *  @brief Function that renders the game state
  *  @param target   RenderWindow where the state will be drawn
  */
-void SettingsState::render(std::shared_ptr<sf::RenderTarget> target)
+void SettingsState::render(std::shared_ptr<RenderSnapshot> target)
 {
-    if (!target)
-        target = window_;
-
     renderButtons(target);
     renderDropDownLists(target);
 }
@@ -70,13 +67,8 @@ void SettingsState::render(std::shared_ptr<sf::RenderTarget> target)
  */
 void SettingsState::loadTextures()
 {
-    sf::Texture texture;
-
-    // Quit button texture
-    if (!texture.loadFromFile("resources/menu/default_button.png"))
-        throw("Error : Could not load quit button texture");
-
-    textures_["DEFAULT_BUTTON"] = std::make_shared<sf::Texture>(texture);
+    // Button texture (shared with the other states)
+    textures_["DEFAULT_BUTTON"] = ResourceCache::getTexture("resources/menu/default_button.png");
 
 }
 
@@ -208,7 +200,7 @@ void SettingsState::updateButtons(const float& dt)
 /**
  * @brief Function that renders the buttons of the state
  */
-void SettingsState::renderButtons(std::shared_ptr<sf::RenderTarget> target)
+void SettingsState::renderButtons(std::shared_ptr<RenderSnapshot> target)
 {
 
     for (auto& button : buttons_)
@@ -250,7 +242,7 @@ void SettingsState::updateDropDownLists(const float& dt)
 /**
  * @brief Function that renders the drop down lists of the state
  */
-void SettingsState::renderDropDownLists(std::shared_ptr<sf::RenderTarget> target)
+void SettingsState::renderDropDownLists(std::shared_ptr<RenderSnapshot> target)
 {
 
     for (const auto& list : dropDownLists_)
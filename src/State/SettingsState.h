@@ -13,7 +13,7 @@ public:
 
     virtual void handleKeyboardInputs();
     virtual void update(const float& dt);
-    virtual void render(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    virtual void render(std::shared_ptr<RenderSnapshot> target = nullptr);
     virtual void loadTextures();
 
 private:
@@ -24,11 +24,11 @@ private:
     virtual void initFonts();
 
     void updateButtons(const float& dt);
-    void renderButtons(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    void renderButtons(std::shared_ptr<RenderSnapshot> target = nullptr);
     void handleButtonEvents();
 
     void updateDropDownLists(const float& dt);
-    void renderDropDownLists(std::shared_ptr<sf::RenderTarget> target = nullptr);
+    void renderDropDownLists(std::shared_ptr<RenderSnapshot> target = nullptr);
 
     // Variables
     sf::Font font_;
@@ -14,6 +14,7 @@ State::State(std::stack<std::unique_ptr<State>>& states, std::shared_ptr<sf::Ren
     ,   keyTime_(0)
     ,   keyTimeMax_(10.0f)
     ,   paused_(false)
+    ,   interpolation_(1.0f)
     ,   quit_(false)
 {
 
@@ -34,6 +35,26 @@ void State::endState()
     quit_ = true;
 }
 
+/**
+ * @brief Function that ends the state and gives the state pushed in its place
+ * The state is popped by the game before the new state is pushed : it is not kept under it
+ * @param state     State replacing this state
+ */
+void State::replaceState(std::unique_ptr<State> state)
+{
+    next_ = std::move(state);
+    endState();
+}
+
+/**
+ * @brief Function that returns the state replacing this state (null when the state is only ended)
+ * @return          State to push
+ */
+std::unique_ptr<State> State::takeNextState()
+{
+    return std::move(next_);
+}
+
 /**
  * @brief Function that updates the key time
  * @param dt        Time since last frame
@@ -44,6 +65,15 @@ void State::updateKeyTime(const float& dt)
         keyTime_ += 50.0f * dt;
 }
 
+/**
+ * @brief Function that sets where the next render is between the last two simulation steps
+ * @param alpha         Time since the last step (fraction of a step)
+ */
+void State::setInterpolation(const float& alpha)
+{
+    interpolation_ = alpha;
+}
+
 /**
  * @brief Method that updates the mouse position
  */
@@ -51,7 +81,8 @@ void State::updateMousePosition()
 {
     mousePositionScreen = sf::Mouse::getPosition();
     mousePositionWindow = sf::Mouse::getPosition(*window_);
-    mousePositionView = window_->mapPixelToCoords(sf::Mouse::getPosition(*window_));
+    // Default view : the view of the window belongs to the render thread
+    mousePositionView = window_->mapPixelToCoords(sf::Mouse::getPosition(*window_), window_->getDefaultView());
 }
 
 /**
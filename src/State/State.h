@@ -5,6 +5,7 @@
 #include "../Window.h"
 #include "../Math/Vector.h"
 #include "../Drawable.h"
+#include "../Render/ResourceCache.h"
 
 class State
     : public Drawable
@@ -17,8 +18,11 @@ public:
 
     // Functions
     void endState();
+    void replaceState(std::unique_ptr<State> state);
+    std::unique_ptr<State> takeNextState();
     virtual void updateMousePosition();
     virtual void updateKeyTime(const float& dt);
+    virtual void setInterpolation(const float& alpha);
     virtual void handleKeyboardInputs() = 0;
     virtual void loadTextures() = 0;
     
@@ -48,6 +52,9 @@ protected:
 
     bool paused_;
 
+    // Time since the last simulation step when rendering (fraction of a step)
+    float interpolation_;
+
     // Functions
     virtual void initKeybinds() = 0;
 
@@ -55,6 +62,7 @@ private:
 
     // Variables
     bool quit_;
+    std::unique_ptr<State> next_;       // Pushed once the state is popped (see replaceState)
 };
 
 #endif
\ No newline at end of file
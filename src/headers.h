@@ -5,19 +5,28 @@
 #include <iostream>
 #include <cmath>
 #include <vector>
+#include <array>
 #include <map>
 #include <stack>
+#include <list>
 #include <fstream>
 #include <functional>
 #include <string>
 #include <stdexcept>
 #include <numeric>
+#include <limits>
 #include <random>
 #include <algorithm>
 #include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
 #include <set>
 #include <unordered_set>
+#include <unordered_map>
 #include <cstring>
+#include <cstdint>
 #include <iomanip>
 #include <sstream>
 